@@ -0,0 +1,51 @@
+#include "bench.hpp"
+
+#include "d3_path/path.hpp"
+#include "d3_path/Arena.hpp"
+
+#include <vector>
+
+namespace {
+
+template <typename P>
+void marker(P& p, int i)
+{
+    p.moveTo(i, 0);
+    p.lineTo(i + 4, 0);
+    p.lineTo(i + 2, 4);
+    p.closePath();
+    p.rect(i, 10, 4, 4);
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(arena) {
+    // A "request": thousands of small temporary paths, all dropped at the end.
+    const int paths = 20000;
+
+    const double heap = bench::measure([&]() {
+        std::vector<d3_path::Path> all;
+        all.reserve(paths);
+        for (int i = 0; i < paths; ++i) {
+            all.push_back(d3_path::path());
+            marker(all.back(), i);
+        }
+        bench::doNotOptimize(all.back().buffer().size());
+    }, 5);
+
+    d3_path::Arena arena(1 << 20);
+    const double arenaSeconds = bench::measure([&]() {
+        {
+            std::vector<d3_path::ArenaPath> all;
+            all.reserve(paths);
+            for (int i = 0; i < paths; ++i) {
+                all.push_back(d3_path::path(arena));
+                marker(all.back(), i);
+            }
+            bench::doNotOptimize(all.back().buffer().size());
+        }
+        arena.release();
+    }, 5);
+
+    std::printf("arena paths=%d  heap %.2f ms  arena %.2f ms\n", paths, heap * 1e3, arenaSeconds * 1e3);
+}
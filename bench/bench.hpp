@@ -0,0 +1,54 @@
+#ifndef D3__PATH__BENCH__BENCH_HPP
+#define D3__PATH__BENCH__BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <string>
+
+namespace bench {
+
+struct Benchmark {
+    const char* name;
+    void (*run)();
+};
+
+inline std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct Registrar {
+    Registrar(const char* name, void (*run)()) {
+        registry().push_back( Benchmark{name, run} );
+    }
+};
+
+// Runs `f` `iterations` times and returns the mean duration in seconds.
+template <typename F>
+double measure(F&& f, int iterations = 5) {
+    using clock = std::chrono::steady_clock;
+
+    f(); // warm-up
+
+    const auto start = clock::now();
+    for (int i = 0; i < iterations; ++i) f();
+    const std::chrono::duration<double> elapsed = clock::now() - start;
+
+    return elapsed.count() / iterations;
+}
+
+// Prevents the optimizer from discarding a result.
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace bench
+
+#define D3_PATH_BENCHMARK(name) \
+    static void name(); \
+    static bench::Registrar name##_registrar(#name, &name); \
+    static void name()
+
+#endif // D3__PATH__BENCH__BENCH_HPP
@@ -0,0 +1,49 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/PathParser.hpp"
+#include "d3_path/CairoPath.hpp"
+
+#include <cmath>
+
+namespace {
+
+// A line chart with rounded markers: 20k lineTo plus 2k full-circle arcs.
+void chart(d3_path::PathInterface& p)
+{
+    const int n = 20000;
+    p.moveTo(0, 300);
+    for (int i = 1; i < n; ++i) p.lineTo(i * 0.1, 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013));
+    for (int i = 0; i < n; i += 10) {
+        const double x = i * 0.1, y = 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013);
+        p.moveTo(x + 3, y);
+        p.arc(x, y, 3, 0, 2 * M_PI);
+    }
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(cairo_path) {
+    cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 2000, 600);
+    cairo_t* cr = cairo_create(surface);
+
+    const double direct = bench::measure([&]() {
+        d3_path::CairoPath c(cr);
+        chart(c);
+        c.clear();
+    });
+
+    const double roundTrip = bench::measure([&]() {
+        d3_path::Path p;
+        chart(p);
+        d3_path::CairoPath c(cr);
+        d3_path::parsePath(p.toString(), c);
+        c.clear();
+    });
+
+    std::printf("CairoPath direct  %.2f ms\n", direct * 1e3);
+    std::printf("Path->SVG->cairo  %.2f ms  (%.1fx)\n", roundTrip * 1e3, roundTrip / direct);
+
+    cairo_destroy(cr);
+    cairo_surface_destroy(surface);
+}
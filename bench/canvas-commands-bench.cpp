@@ -0,0 +1,45 @@
+#include "bench.hpp"
+
+#include "d3_path/CanvasCommands.hpp"
+#include "d3_path/Path.hpp"
+
+#include <random>
+
+D3_PATH_BENCHMARK(canvas_commands) {
+    const int points = 200000;
+
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<double> uy(0, 600);
+
+    d3_path::RecordedPath recorded;
+    recorded.moveTo(0, uy(rng));
+    for (int i = 1; i < points; ++i) recorded.lineTo(i * 800.0 / points, uy(rng));
+
+    std::string out;
+
+    const double svg = bench::measure([&]() {
+        d3_path::Path path;
+        recorded.replay(path);
+        out = path.toString();
+    });
+    std::printf("svg                bytes=%zu  %.2f ms\n", out.size(), svg * 1e3);
+
+    const double json = bench::measure([&]() {
+        out.clear();
+        d3_path::StringSink sink(out);
+        d3_path::encodeCommandsJson(recorded, sink);
+    });
+    std::printf("json precision=3   bytes=%zu  %.2f ms\n", out.size(), json * 1e3);
+
+    const double binary = bench::measure([&]() {
+        out.clear();
+        d3_path::StringSink sink(out);
+        d3_path::encodeCommands(recorded, sink);
+    });
+    std::printf("binary             bytes=%zu  %.2f ms\n", out.size(), binary * 1e3);
+
+    const double decode = bench::measure([&]() {
+        bench::doNotOptimize(d3_path::decodeCommands(out.data(), out.size()).numbers().size());
+    });
+    std::printf("binary decode      %.2f ms\n", decode * 1e3);
+}
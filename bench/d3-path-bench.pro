@@ -0,0 +1,54 @@
+TEMPLATE = app
+CONFIG += console c++11 release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+INCLUDEPATH += $$PWD
+
+include($$PWD/../src/d3_path.pri)
+include($$PWD/../src/d3_path_png.pri)
+
+SOURCES += \
+    main.cpp \
+    simplifier-bench.cpp \
+    decimation-bench.cpp \
+    quantizer-bench.cpp \
+    shape-dictionary-bench.cpp \
+    rasterizer-bench.cpp \
+    image-encoder-bench.cpp \
+    pdf-path-bench.cpp \
+    eps-path-bench.cpp \
+    canvas-commands-bench.cpp \
+    tessellator-bench.cpp \
+    stroker-bench.cpp \
+    path-boolean-bench.cpp \
+    tee-path-bench.cpp \
+    arena-bench.cpp \
+    path-pool-bench.cpp \
+    inline-buffer-bench.cpp
+
+HEADERS += \
+    bench.hpp
+
+# Writing to file descriptors (writev, mmap)
+unix {
+    SOURCES += \
+        rope-buffer-bench.cpp \
+        mapped-file-bench.cpp
+}
+
+# Optional backends: qmake CONFIG+=d3_path_qt CONFIG+=d3_path_skia SKIA_DIR=… CONFIG+=d3_path_cairo
+d3_path_qt {
+    include($$PWD/../src/d3_path_qt.pri)
+    SOURCES += qt-path-bench.cpp
+}
+
+d3_path_skia {
+    include($$PWD/../src/d3_path_skia.pri)
+    SOURCES += skia-path-bench.cpp
+}
+
+d3_path_cairo {
+    include($$PWD/../src/d3_path_cairo.pri)
+    SOURCES += cairo-path-bench.cpp
+}
@@ -0,0 +1,45 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/Decimation.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+void run(const char* label, std::size_t n, unsigned threads, bool lttb) {
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0, 1);
+
+    std::vector<double> xs(n), ys(n);
+    for (std::size_t i = 0; i < n; ++i) { xs[i] = i; ys[i] = 100 * std::sin(i * 1e-5) + noise(rng); }
+
+    const std::size_t width = 1500;
+    std::vector<std::size_t> indices;
+    std::size_t bytes = 0;
+
+    const double seconds = bench::measure([&]() {
+        indices.clear();
+        if (lttb) d3_path::decimateLttb(xs.data(), ys.data(), n, 2 * width, indices, threads);
+        else      d3_path::decimateM4(xs.data(), ys.data(), n, xs.front(), xs.back(), width, indices, threads);
+
+        d3_path::Path p;
+        d3_path::drawIndices(p, xs.data(), ys.data(), indices);
+        bytes = p.toString().size();
+    });
+
+    std::printf("%-5s n=%-9zu threads=%u kept=%zu bytes=%zu  %.2f ms (%.2f ns/point)\n",
+                label, n, threads, indices.size(), bytes, seconds * 1e3, seconds * 1e9 / n);
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(decimation) {
+    for (const std::size_t n : { std::size_t(1000000), std::size_t(10000000) }) {
+        for (const unsigned threads : { 1u, 0u }) {
+            run("m4",   n, threads, false);
+            run("lttb", n, threads, true);
+        }
+    }
+}
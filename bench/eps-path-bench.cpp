@@ -0,0 +1,41 @@
+#include "bench.hpp"
+
+#include "d3_path/EpsPath.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(eps_path) {
+    const int points = 200000;
+
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<double> uy(50, 550);
+    std::vector<double> ys(points);
+    for (double& y : ys) y = uy(rng);
+
+    std::string out;
+
+    const double seconds = bench::measure([&]() {
+        out.clear();
+        d3_path::StringSink sink(out);
+        d3_path::EpsPath eps(sink, 800, 600);
+
+        // A dense line chart and a dot per 20 points.
+        eps.setLineWidth(0.5);
+        eps.moveTo(0, ys[0]);
+        for (int i = 1; i < points; ++i) eps.lineTo(i * 800.0 / points, ys[i]);
+        eps.stroke();
+
+        eps.setFillColor(0.8, 0.16, 0.16);
+        for (int i = 0; i < points; i += 20) {
+            const double x = i * 800.0 / points;
+            eps.moveTo(x + 2, ys[i]);
+            eps.arc(x, ys[i], 2, 0, 2 * M_PI);
+        }
+        eps.fill();
+        eps.finish();
+    });
+
+    std::printf("eps_path           points=%d bytes=%zu  %.2f ms  %.0f MB/s\n",
+                points, out.size(), seconds * 1e3, out.size() / seconds / 1e6);
+}
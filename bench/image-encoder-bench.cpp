@@ -0,0 +1,70 @@
+#include "bench.hpp"
+
+#include "d3_path/Rasterizer.hpp"
+#include "d3_path/Png.hpp"
+#include "d3_path/Qoi.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+// A typical chart thumbnail: white background, a translucent area, a line of dots.
+d3_path::Canvas chart(std::size_t width, std::size_t height)
+{
+    d3_path::Canvas canvas(width, height, d3_path::Color{255, 255, 255, 255});
+
+    d3_path::Rasterizer area;
+    area.moveTo(0, height);
+    for (std::size_t x = 0; x <= width; x += 2) {
+        area.lineTo(x, height * (0.5 + 0.3 * std::sin(x / 90.0) * std::cos(x / 410.0)));
+    }
+    area.lineTo(width, height);
+    area.fill(canvas, d3_path::Color{70, 130, 180, 160});
+
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> ux(0, width), uy(0, height);
+    d3_path::Rasterizer dots;
+    for (int i = 0; i < 800; ++i) {
+        const double x = ux(rng), y = uy(rng);
+        dots.moveTo(x + 3, y);
+        dots.arc(x, y, 3, 0, 2 * M_PI);
+    }
+    dots.fill(canvas, d3_path::Color{200, 40, 40, 255});
+    return canvas;
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(image_encoder) {
+    const std::size_t width = 1600, height = 1000;
+    const d3_path::Canvas canvas = chart(width, height);
+    const double megapixels = width * height / 1e6;
+
+    std::string out;
+    out.reserve(canvas.stride() * height);
+
+    const double qoi = bench::measure([&]() {
+        out.clear();
+        d3_path::StringSink sink(out);
+        d3_path::encodeQoi(canvas, sink);
+    });
+    std::printf("qoi                %zux%zu bytes=%zu  %.2f ms  %.0f MP/s\n",
+                width, height, out.size(), qoi * 1e3, megapixels / qoi);
+
+    for (const int level : { 1, 6 }) {
+        for (const unsigned threads : { 1u, 0u }) {
+            d3_path::PngOptions options;
+            options.level = level;
+            options.threads = threads;
+
+            const double png = bench::measure([&]() {
+                out.clear();
+                d3_path::StringSink sink(out);
+                d3_path::encodePng(canvas, sink, options);
+            });
+            std::printf("png level=%d threads=%-3s bytes=%zu  %.2f ms  %.0f MP/s\n",
+                        level, threads ? "1" : "all", out.size(), png * 1e3, megapixels / png);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#include "bench.hpp"
+
+#include "d3_path/path.hpp"
+#include "d3_path/InlinePath.hpp"
+
+#include <cmath>
+
+namespace {
+
+// A circle marker, as d3.symbol() draws one: about 60 bytes.
+template <typename P>
+void marker(P& p, double x, double y)
+{
+    p.moveTo(x + 4.5, y);
+    p.arc(x, y, 4.5, 0, 2 * M_PI);
+    p.closePath();
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(inline_buffer) {
+    // A 1M-point scatter plot: one short-lived path per marker.
+    const int markers = 1000000;
+
+    std::size_t bytes = 0, heapPath = 0, heapInline = 0;
+    const double heap = bench::measure([&]() {
+        heapPath = 0;
+        for (int i = 0; i < markers; ++i) {
+            d3_path::Path p;
+            marker(p, i % 1000, i / 1000);
+            bytes += p.buffer().size();
+            heapPath += p.capacity() > std::string().capacity();
+        }
+    }, 3);
+
+    const double inlined = bench::measure([&]() {
+        heapInline = 0;
+        for (int i = 0; i < markers; ++i) {
+            d3_path::InlinePath<128> p;
+            marker(p, i % 1000, i / 1000);
+            bytes += p.buffer().size();
+            heapInline += !p.buffer().inlined();
+        }
+    }, 3);
+    bench::doNotOptimize(bytes);
+
+    std::printf("inline_buffer markers=%d  Path %.2f ms (%zu heap buffers)  InlinePath<128> %.2f ms (%zu heap buffers)\n",
+                markers, heap * 1e3, heapPath, inlined * 1e3, heapInline);
+}
@@ -0,0 +1,19 @@
+#include "bench.hpp"
+
+#include <cstring> // for std::strstr()
+
+// Usage: d3-path-bench [filter]
+// Runs every registered benchmark whose name contains `filter`.
+int main(int argc, char* argv[])
+{
+    const char* filter = (argc > 1) ? argv[1] : "";
+
+    for (const bench::Benchmark& benchmark : bench::registry()) {
+        if (std::strstr(benchmark.name, filter) == nullptr) continue;
+
+        std::printf("# %s\n", benchmark.name);
+        benchmark.run();
+    }
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include "bench.hpp"
+
+#include "d3_path/path.hpp"
+#include "d3_path/MappedFile.hpp"
+#include "d3_path/Sink.hpp"
+
+#include <string>
+#include <unistd.h> // for ::getpid(), ::unlink()
+
+namespace {
+
+template <typename P>
+void contour(P& p, int points)
+{
+    p.moveTo(0, 0);
+    for (int i = 1; i < points; ++i) p.lineTo(i, i % 97);
+    p.closePath();
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(mapped_file) {
+    const int points = 4000000;
+    const std::string filename = "/tmp/d3-path-bench-" + std::to_string(::getpid()) + ".path";
+
+    std::size_t bytes = 0;
+    const double buffered = bench::measure([&]() {
+        d3_path::Path p;
+        contour(p, points);
+        const std::string s = p.toString();
+        bytes = s.size();
+        d3_path::FileSink sink(filename);
+        sink.write(s);
+    }, 3);
+
+    const double mapped = bench::measure([&]() {
+        d3_path::MappedPath p( d3_path::MappedFile(filename, d3_path::MappedFile::DEFAULT_EXTENT) );
+        contour(p, points);
+        p.buffer().close();
+    }, 3);
+
+    ::unlink(filename.c_str());
+    std::printf("mapped_file bytes=%zu  Path + toString() + FileSink %.2f ms  MappedPath %.2f ms\n",
+                bytes, buffered * 1e3, mapped * 1e3);
+}
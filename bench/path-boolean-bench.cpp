@@ -0,0 +1,35 @@
+#include "bench.hpp"
+
+#include "d3_path/PathBoolean.hpp"
+#include "d3_path/RecordedPath.hpp"
+
+#include <cmath>
+
+D3_PATH_BENCHMARK(path_boolean) {
+    // Union of a 32×32 grid of overlapping circles, e.g. buffered points on a map.
+    const int side = 32;
+
+    std::vector<d3_path::RecordedPath> circles;
+    for (int i = 0; i < side; ++i) {
+        for (int j = 0; j < side; ++j) {
+            d3_path::RecordedPath circle;
+            circle.moveTo(10 * i + 7, 10 * j);
+            circle.arc(10 * i, 10 * j, 7, 0, 2 * M_PI);
+            circle.closePath();
+            circles.push_back(circle);
+        }
+    }
+
+    d3_path::RecordedPath out;
+    for (const unsigned threads : { 1u, 0u }) {
+        d3_path::BooleanOptions options;
+        options.threads = threads;
+
+        const double seconds = bench::measure([&]() {
+            out.clear();
+            d3_path::booleanOp(circles, d3_path::BooleanOp::Union, out, options);
+        }, 3);
+        std::printf("path_boolean union paths=%zu threads=%s outline=%zu  %.2f ms\n",
+                    circles.size(), threads ? "1" : "all", out.commands().size(), seconds * 1e3);
+    }
+}
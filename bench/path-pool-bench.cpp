@@ -0,0 +1,28 @@
+#include "bench.hpp"
+
+#include "d3_path/path.hpp"
+
+D3_PATH_BENCHMARK(path_pool) {
+    // One path per data point, each serialized and dropped, as a scatter plot would.
+    const int paths = 100000;
+
+    std::size_t bytes = 0;
+    const double fresh = bench::measure([&]() {
+        for (int i = 0; i < paths; ++i) {
+            auto p = d3_path::path();
+            for (int j = 0; j < 8; ++j) p.lineTo(i + j, j);
+            bytes += p.buffer().size();
+        }
+    }, 3);
+
+    const double pooled = bench::measure([&]() {
+        for (int i = 0; i < paths; ++i) {
+            auto p = d3_path::pooledPath();
+            for (int j = 0; j < 8; ++j) p->lineTo(i + j, j);
+            bytes += p->buffer().size();
+        }
+    }, 3);
+    bench::doNotOptimize(bytes);
+
+    std::printf("path_pool paths=%d  path() %.2f ms  pooledPath() %.2f ms\n", paths, fresh * 1e3, pooled * 1e3);
+}
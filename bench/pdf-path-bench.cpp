@@ -0,0 +1,48 @@
+#include "bench.hpp"
+
+#include "d3_path/PdfPath.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(pdf_path) {
+    const int pages = 1000, points = 500;
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> uy(50, 550);
+    std::vector<double> ys(points);
+    for (double& y : ys) y = uy(rng);
+
+    std::string out;
+
+    const double seconds = bench::measure([&]() {
+        out.clear();
+        d3_path::StringSink sink(out);
+        d3_path::PdfPath pdf(sink);
+        for (int page = 0; page < pages; ++page) {
+            pdf.beginPage(800, 600);
+
+            // A line chart, a few bars and a dot per point.
+            pdf.setStrokeColor(0.27, 0.51, 0.71);
+            pdf.setLineWidth(1.5);
+            pdf.moveTo(0, ys[0]);
+            for (int i = 1; i < points; ++i) pdf.lineTo(i * 1.6, ys[(i + page) % points]);
+            pdf.stroke();
+
+            pdf.setFillColor(0.8, 0.16, 0.16);
+            for (int i = 0; i < points; i += 10) {
+                const double x = i * 1.6, y = ys[(i + page) % points];
+                pdf.moveTo(x + 2, y);
+                pdf.arc(x, y, 2, 0, 2 * M_PI);
+            }
+            pdf.fill();
+
+            for (int i = 0; i < 20; ++i) pdf.rect(i * 40 + 5, 600 - ys[i] / 2, 30, ys[i] / 2);
+            pdf.fill();
+        }
+        pdf.finish();
+    }, 3);
+
+    std::printf("pdf_path           pages=%d bytes=%zu  %.2f ms  %.0f MB/s  %.0f pages/s\n",
+                pages, out.size(), seconds * 1e3, out.size() / seconds / 1e6, pages / seconds);
+}
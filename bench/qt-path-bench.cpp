@@ -0,0 +1,45 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/PathParser.hpp"
+#include "d3_path/QtPath.hpp"
+
+#include <cmath>
+
+namespace {
+
+// A line chart with rounded markers: 20k lineTo plus 2k full-circle arcs.
+void chart(d3_path::PathInterface& p)
+{
+    const int n = 20000;
+    p.moveTo(0, 300);
+    for (int i = 1; i < n; ++i) p.lineTo(i * 0.1, 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013));
+    for (int i = 0; i < n; i += 10) {
+        const double x = i * 0.1, y = 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013);
+        p.moveTo(x + 3, y);
+        p.arc(x, y, 3, 0, 2 * M_PI);
+    }
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(qt_path) {
+    int direct = 0, roundTrip = 0;
+
+    const double directSeconds = bench::measure([&]() {
+        d3_path::QtPath q;
+        chart(q);
+        direct = q.path().elementCount();
+    });
+
+    const double roundTripSeconds = bench::measure([&]() {
+        d3_path::Path p;
+        chart(p);
+        d3_path::QtPath q;
+        d3_path::parsePath(p.toString(), q);
+        roundTrip = q.path().elementCount();
+    });
+
+    std::printf("QtPath direct    elements=%d  %.2f ms\n", direct, directSeconds * 1e3);
+    std::printf("Path->SVG->Qt    elements=%d  %.2f ms  (%.1fx)\n", roundTrip, roundTripSeconds * 1e3, roundTripSeconds / directSeconds);
+}
@@ -0,0 +1,36 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/PathQuantizer.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(quantizer) {
+    // 1M points squeezed into 1500 px: most neighbours land on the same 1/8 px.
+    const std::size_t n = 1000000;
+    std::mt19937 rng(3);
+    std::normal_distribution<double> noise(0, 0.02);
+
+    std::vector<double> xs(n), ys(n);
+    for (std::size_t i = 0; i < n; ++i) { xs[i] = 1500.0 * i / n; ys[i] = 200 + 100 * std::sin(i * 1e-5) + noise(rng); }
+
+    std::size_t plain = 0, quantized = 0, dropped = 0;
+
+    const double seconds = bench::measure([&]() {
+        d3_path::Path p;
+        d3_path::PathQuantizer q(p, 0.125);
+        q.moveTo(xs[0], ys[0]);
+        for (std::size_t i = 1; i < n; ++i) q.lineTo(xs[i], ys[i]);
+        quantized = q.toString().size();
+        dropped = q.dropped();
+    });
+
+    d3_path::Path p;
+    p.moveTo(xs[0], ys[0]);
+    for (std::size_t i = 1; i < n; ++i) p.lineTo(xs[i], ys[i]);
+    plain = p.toString().size();
+
+    std::printf("grid=1/8 dropped=%zu/%zu bytes=%zu -> %zu (%.1f%%)  %.2f ms\n",
+                dropped, n - 1, plain, quantized, 100.0 * quantized / plain, seconds * 1e3);
+}
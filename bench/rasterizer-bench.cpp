@@ -0,0 +1,43 @@
+#include "bench.hpp"
+
+#include "d3_path/Rasterizer.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(rasterizer) {
+    // A 1200×800 thumbnail: an area chart over 2000 samples plus 5000 scatter dots.
+    const std::size_t width = 1200, height = 800, samples = 2000, dots = 5000;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> ux(0, width), uy(0, height);
+
+    d3_path::Rasterizer area, scatter;
+    area.moveTo(0, height);
+    for (std::size_t i = 0; i < samples; ++i) {
+        const double x = double(width) * i / (samples - 1);
+        area.lineTo(x, 400 + 250 * std::sin(x / 90) * std::cos(x / 410));
+    }
+    area.lineTo(width, height);
+    area.closePath();
+    for (std::size_t i = 0; i < dots; ++i) {
+        const double x = ux(rng), y = uy(rng);
+        scatter.moveTo(x + 3, y);
+        scatter.arc(x, y, 3, 0, 2 * M_PI);
+    }
+
+    for (const unsigned threads : { 1u, 0u }) {
+        area.setThreads(threads);
+        scatter.setThreads(threads);
+
+        const double seconds = bench::measure([&]() {
+            d3_path::Canvas canvas(width, height, d3_path::Color{255, 255, 255, 255});
+            area.fill(canvas, d3_path::Color{70, 130, 180, 160});
+            scatter.fill(canvas, d3_path::Color{200, 40, 40, 255});
+            bench::doNotOptimize(canvas.data());
+        });
+
+        std::printf("%zux%zu threads=%s edges=%zu  %.2f ms\n",
+                    width, height, threads ? "1" : "all",
+                    area.points().size() + scatter.points().size(), seconds * 1e3);
+    }
+}
@@ -0,0 +1,43 @@
+#include "bench.hpp"
+
+#include "d3_path/path.hpp"
+#include "d3_path/RopePath.hpp"
+
+#include <fcntl.h>  // for ::open()
+#include <unistd.h> // for ::write(), ::close()
+
+namespace {
+
+template <typename P>
+void contour(P& p, int points)
+{
+    p.moveTo(0, 0);
+    for (int i = 1; i < points; ++i) p.lineTo(i, i % 97);
+    p.closePath();
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(rope_buffer) {
+    const int points = 2000000;
+    const int fd = ::open("/dev/null", O_WRONLY);
+
+    std::size_t bytes = 0;
+    const double contiguous = bench::measure([&]() {
+        d3_path::Path p;
+        contour(p, points);
+        const std::string s = p.toString();
+        bytes = s.size();
+        bench::doNotOptimize(::write(fd, s.data(), s.size()));
+    }, 3);
+
+    const double rope = bench::measure([&]() {
+        d3_path::RopePath p;
+        contour(p, points);
+        p.buffer().writeTo(fd);
+    }, 3);
+
+    ::close(fd);
+    std::printf("rope_buffer bytes=%zu  Path + toString() %.2f ms  RopePath + writev %.2f ms\n",
+                bytes, contiguous * 1e3, rope * 1e3);
+}
@@ -0,0 +1,40 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/ShapeDictionary.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(shape_dictionary) {
+    // Scatter plot: 100k circle markers of three sizes.
+    const std::size_t n = 100000;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> position(0, 1000);
+
+    std::vector<double> xs(n), ys(n);
+    for (std::size_t i = 0; i < n; ++i) { xs[i] = position(rng); ys[i] = position(rng); }
+
+    const auto draw = [&](d3_path::PathInterface& p) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const double r = 2 + i % 3;
+            p.moveTo(xs[i] + r, ys[i]);
+            p.arc(xs[i], ys[i], r, 0, 2 * M_PI);
+        }
+    };
+
+    std::size_t plain = 0, svg = 0, shapes = 0;
+
+    const double pathSeconds = bench::measure([&]() {
+        d3_path::Path p; draw(p);
+        plain = p.toString().size();
+    });
+    const double dictionarySeconds = bench::measure([&]() {
+        d3_path::ShapeDictionary d; draw(d);
+        svg = d.toSvg().size();
+        shapes = d.shapes();
+    });
+
+    std::printf("markers=%zu shapes=%zu path bytes=%zu (%.2f ms) defs/use bytes=%zu (%.2f ms)\n",
+                n, shapes, plain, pathSeconds * 1e3, svg, dictionarySeconds * 1e3);
+}
@@ -0,0 +1,48 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/PathSimplifier.hpp"
+
+#include <random>
+
+namespace {
+
+// Random walk resembling a noisy sensor trace.
+std::vector<double> randomWalk(std::size_t n, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> step(0, 1);
+
+    std::vector<double> ys(n);
+    double y = 0;
+    for (double& v : ys) v = (y += step(rng));
+    return ys;
+}
+
+void run(const char* label, d3_path::PathSimplifier::Algorithm algorithm, double tolerance) {
+    const std::size_t n = 1000000;
+    const std::vector<double> ys = randomWalk(n, 42);
+
+    std::size_t in = 0, out = 0, bytes = 0;
+
+    const double seconds = bench::measure([&]() {
+        d3_path::Path p;
+        d3_path::PathSimplifier s(p, tolerance, algorithm);
+        s.moveTo(0, ys[0]);
+        for (std::size_t i = 1; i < n; ++i) s.lineTo(i * 0.01, ys[i]);
+        s.flush();
+        in = s.verticesIn(); out = s.verticesOut();
+        bytes = p.toString().size();
+    });
+
+    std::printf("%-20s tolerance=%-5g removed=%zu/%zu (%.1f%%) bytes=%zu  %.2f ms per 1M points\n",
+                label, tolerance, in - out, in, 100.0 * (in - out) / in, bytes, seconds * 1e3 * (1e6 / n));
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(simplifier) {
+    for (const double tolerance : {0.25, 0.5, 1.0}) {
+        run("douglas-peucker",    d3_path::PathSimplifier::Algorithm::DouglasPeucker,    tolerance);
+        run("visvalingam-whyatt", d3_path::PathSimplifier::Algorithm::VisvalingamWhyatt, tolerance);
+    }
+}
@@ -0,0 +1,62 @@
+#include "bench.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/SkiaPath.hpp"
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPaint.h"
+#include "include/utils/SkParsePath.h"
+
+#include <cmath>
+
+namespace {
+
+// A line chart with rounded markers: 20k lineTo plus 2k full-circle arcs.
+void chart(d3_path::PathInterface& p)
+{
+    const int n = 20000;
+    p.moveTo(0, 300);
+    for (int i = 1; i < n; ++i) p.lineTo(i * 0.1, 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013));
+    for (int i = 0; i < n; i += 10) {
+        const double x = i * 0.1, y = 300 + 200 * std::sin(i * 0.002) * std::cos(i * 0.013);
+        p.moveTo(x + 3, y);
+        p.arc(x, y, 3, 0, 2 * M_PI);
+    }
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(skia_path) {
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(2000, 600);
+    SkCanvas canvas(bitmap);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setStyle(SkPaint::kStroke_Style);
+
+    const double direct = bench::measure([&]() {
+        d3_path::SkiaPath s;
+        chart(s);
+        bench::doNotOptimize(s.path().countVerbs());
+    });
+
+    const double roundTrip = bench::measure([&]() {
+        d3_path::Path p;
+        chart(p);
+        SkPath s;
+        SkParsePath::FromSVGString(p.toString().c_str(), &s);
+        bench::doNotOptimize(s.countVerbs());
+    });
+
+    d3_path::SkiaPath s;
+    chart(s);
+    const double draw = bench::measure([&]() {
+        canvas.clear(SK_ColorWHITE);
+        canvas.drawPath(s.path(), paint);
+    });
+
+    std::printf("SkiaPath direct  %.2f ms\n", direct * 1e3);
+    std::printf("Path->SVG->Skia  %.2f ms  (%.1fx)\n", roundTrip * 1e3, roundTrip / direct);
+    std::printf("(drawPath of the result: %.2f ms)\n", draw * 1e3);
+}
@@ -0,0 +1,30 @@
+#include "bench.hpp"
+
+#include "d3_path/Stroker.hpp"
+#include "d3_path/RecordedPath.hpp"
+
+#include <random>
+
+D3_PATH_BENCHMARK(stroker) {
+    const int points = 1000000;
+
+    std::mt19937 rng(14);
+    std::uniform_real_distribution<double> uy(0, 600);
+    std::vector<double> ys(points);
+    for (double& y : ys) y = uy(rng);
+
+    d3_path::RecordedPath outline;
+    const char* const names[] = { "miter", "round", "bevel" };
+
+    for (const d3_path::LineJoin join : { d3_path::LineJoin::Miter, d3_path::LineJoin::Bevel, d3_path::LineJoin::Round }) {
+        const double seconds = bench::measure([&]() {
+            outline.clear();
+            d3_path::Stroker stroker(outline, d3_path::StrokeStyle(1.5, join));
+            stroker.moveTo(0, ys[0]);
+            for (int i = 1; i < points; ++i) stroker.lineTo(i * 0.01, ys[i]);
+            stroker.finish();
+        }, 3);
+        std::printf("stroker join=%-6s segments=%d outline=%zu  %.2f ms  %.1f M segments/s\n",
+                    names[static_cast<int>(join)], points - 1, outline.commands().size(), seconds * 1e3, points / seconds / 1e6);
+    }
+}
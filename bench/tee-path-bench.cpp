@@ -0,0 +1,53 @@
+#include "bench.hpp"
+
+#include "d3_path/RecordedPath.hpp"
+#include "d3_path/TeePath.hpp"
+
+#include <cmath>
+
+namespace {
+
+// A generator doing its own trig, like a d3-shape arc / line generator.
+template <typename P>
+void generate(P& p, int points)
+{
+    for (int i = 0; i < points; ++i) {
+        const double a = i * 0.001, r = 100 + 50 * std::sin(a * 7);
+        if (i % 100 == 0) p.moveTo(r * std::cos(a), r * std::sin(a));
+        else if (i % 3 == 0) p.bezierCurveTo(r * std::cos(a - 0.0006), r * std::sin(a - 0.0006), r * std::cos(a - 0.0003), r * std::sin(a - 0.0003), r * std::cos(a), r * std::sin(a));
+        else p.lineTo(r * std::cos(a), r * std::sin(a));
+    }
+}
+
+} // namespace
+
+D3_PATH_BENCHMARK(tee_path) {
+    const int points = 300000;
+
+    // Cheap targets, so the generator and the dispatch dominate.
+    d3_path::RecordedPath recorded, copy;
+
+    const double twice = bench::measure([&]() {
+        recorded.clear();
+        copy.clear();
+        generate<d3_path::PathInterface>(recorded, points);
+        generate<d3_path::PathInterface>(copy, points);
+    }, 5);
+
+    const double runtime = bench::measure([&]() {
+        recorded.clear();
+        copy.clear();
+        d3_path::TeePath tee({ &recorded, &copy });
+        generate<d3_path::PathInterface>(tee, points);
+    }, 5);
+
+    const double compileTime = bench::measure([&]() {
+        recorded.clear();
+        copy.clear();
+        auto tee = d3_path::tee(recorded, copy);
+        generate(tee, points);
+    }, 5);
+
+    std::printf("tee_path points=%d  twice %.2f ms  TeePath %.2f ms  tee() %.2f ms\n",
+                points, twice * 1e3, runtime * 1e3, compileTime * 1e3);
+}
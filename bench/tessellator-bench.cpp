@@ -0,0 +1,39 @@
+#include "bench.hpp"
+
+#include "d3_path/Tessellator.hpp"
+
+#include <cmath>
+#include <random>
+
+D3_PATH_BENCHMARK(tessellator) {
+    const double width = 1600, height = 1000;
+
+    // An area chart and scattered dots, as in the rasterizer benchmark.
+    d3_path::Tessellator area(0.2);
+    area.moveTo(0, height);
+    for (double x = 0; x <= width; x += 2) {
+        area.lineTo(x, height * (0.5 + 0.3 * std::sin(x / 90.0) * std::cos(x / 410.0)));
+    }
+    area.lineTo(width, height);
+
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> ux(0, width), uy(0, height);
+    d3_path::Tessellator dots(0.2);
+    for (int i = 0; i < 2000; ++i) {
+        const double x = ux(rng), y = uy(rng);
+        dots.moveTo(x + 3, y);
+        dots.arc(x, y, 3, 0, 2 * M_PI);
+    }
+
+    d3_path::Mesh mesh;
+    for (const d3_path::FillRule rule : { d3_path::FillRule::NonZero, d3_path::FillRule::EvenOdd }) {
+        const double seconds = bench::measure([&]() {
+            mesh.clear();
+            area.fill(mesh, rule);
+            dots.fill(mesh, rule);
+        });
+        std::printf("tessellator %-8s vertices=%zu triangles=%zu  %.2f ms\n",
+                    rule == d3_path::FillRule::NonZero ? "nonzero" : "evenodd",
+                    mesh.vertexCount(), mesh.triangleCount(), seconds * 1e3);
+    }
+}
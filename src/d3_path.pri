@@ -2,9 +2,75 @@ INCLUDEPATH += \
     $$PWD
 
 SOURCES += \
-    $$PWD/d3_path/Path.cpp
+    $$PWD/d3_path/Path.cpp \
+    $$PWD/d3_path/PathSimplifier.cpp \
+    $$PWD/d3_path/Decimation.cpp \
+    $$PWD/d3_path/PathNormalizer.cpp \
+    $$PWD/d3_path/AffineTransform.cpp \
+    $$PWD/d3_path/PathTransform.cpp \
+    $$PWD/d3_path/PathQuantizer.cpp \
+    $$PWD/d3_path/RecordedPath.cpp \
+    $$PWD/d3_path/ShapeDictionary.cpp \
+    $$PWD/d3_path/PathFlattener.cpp \
+    $$PWD/d3_path/Canvas.cpp \
+    $$PWD/d3_path/Rasterizer.cpp \
+    $$PWD/d3_path/Sink.cpp \
+    $$PWD/d3_path/Qoi.cpp \
+    $$PWD/d3_path/PathParser.cpp \
+    $$PWD/d3_path/PdfPath.cpp \
+    $$PWD/d3_path/EpsPath.cpp \
+    $$PWD/d3_path/CanvasCommands.cpp \
+    $$PWD/d3_path/Tessellator.cpp \
+    $$PWD/d3_path/Stroker.cpp \
+    $$PWD/d3_path/PathBoolean.cpp \
+    $$PWD/d3_path/TeePath.cpp \
+    $$PWD/d3_path/Arena.cpp \
+    $$PWD/d3_path/PathPool.cpp \
+    $$PWD/d3_path/RopeBuffer.cpp \
+    $$PWD/d3_path/FrozenPath.cpp
 
 HEADERS += \
     $$PWD/d3_path/Path.hpp \
     $$PWD/d3_path/PathInterface.hpp \
+    $$PWD/d3_path/PathSimplifier.hpp \
+    $$PWD/d3_path/Decimation.hpp \
+    $$PWD/d3_path/PathNormalizer.hpp \
+    $$PWD/d3_path/AffineTransform.hpp \
+    $$PWD/d3_path/PathTransform.hpp \
+    $$PWD/d3_path/PathQuantizer.hpp \
+    $$PWD/d3_path/RecordedPath.hpp \
+    $$PWD/d3_path/ShapeDictionary.hpp \
+    $$PWD/d3_path/PathFlattener.hpp \
+    $$PWD/d3_path/FillRule.hpp \
+    $$PWD/d3_path/Canvas.hpp \
+    $$PWD/d3_path/Rasterizer.hpp \
+    $$PWD/d3_path/Sink.hpp \
+    $$PWD/d3_path/Qoi.hpp \
+    $$PWD/d3_path/PathParser.hpp \
+    $$PWD/d3_path/PdfPath.hpp \
+    $$PWD/d3_path/EpsPath.hpp \
+    $$PWD/d3_path/CanvasCommands.hpp \
+    $$PWD/d3_path/Mesh.hpp \
+    $$PWD/d3_path/Tessellator.hpp \
+    $$PWD/d3_path/Stroker.hpp \
+    $$PWD/d3_path/PathBoolean.hpp \
+    $$PWD/d3_path/TeePath.hpp \
+    $$PWD/d3_path/Arena.hpp \
+    $$PWD/d3_path/PathPool.hpp \
+    $$PWD/d3_path/RopeBuffer.hpp \
+    $$PWD/d3_path/RopePath.hpp \
+    $$PWD/d3_path/FrozenPath.hpp \
+    $$PWD/d3_path/InlineBuffer.hpp \
+    $$PWD/d3_path/InlinePath.hpp \
+    $$PWD/d3_path/detail/constants.hpp \
+    $$PWD/d3_path/detail/to_str.hpp \
+    $$PWD/d3_path/detail/fixed.hpp \
+    $$PWD/d3_path/detail/parallel.hpp \
+    $$PWD/d3_path/detail/basic_path.hpp \
     $$PWD/d3_path/path.hpp
+
+# Memory-mapped output (mmap)
+unix {
+    SOURCES += $$PWD/d3_path/MappedFile.cpp
+    HEADERS += $$PWD/d3_path/MappedFile.hpp
+}
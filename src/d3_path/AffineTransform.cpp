@@ -0,0 +1,108 @@
+#include "d3_path/AffineTransform.hpp"
+
+#include <cmath> // for std::abs(), std::sqrt(), std::cos(), std::sin()
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace d3_path {
+
+AffineTransform::AffineTransform(number_t a, number_t b, number_t c, number_t d, number_t e, number_t f)
+    : a( a ), b( b ), c( c ), d( d ), e( e ), f( f )
+{ }
+
+AffineTransform AffineTransform::translate(number_t tx, number_t ty)
+{
+    return AffineTransform(1, 0, 0, 1, tx, ty);
+}
+
+AffineTransform AffineTransform::scale(number_t sx, number_t sy)
+{
+    return AffineTransform(sx, 0, 0, sy, 0, 0);
+}
+
+AffineTransform AffineTransform::rotate(number_t angle)
+{
+    const number_t
+            cos = std::cos(angle),
+            sin = std::sin(angle);
+    return AffineTransform(cos, sin, -sin, cos, 0, 0);
+}
+
+AffineTransform AffineTransform::operator*(const AffineTransform& o) const
+{
+    return AffineTransform(this->a * o.a + this->c * o.b,
+                           this->b * o.a + this->d * o.b,
+                           this->a * o.c + this->c * o.d,
+                           this->b * o.c + this->d * o.d,
+                           this->a * o.e + this->c * o.f + this->e,
+                           this->b * o.e + this->d * o.f + this->f);
+}
+
+bool AffineTransform::isSimilarity() const
+{
+    // Relative tolerance, so products of rotations still qualify.
+    const number_t tolerance = 1e-9 * (std::abs(this->a) + std::abs(this->b) + std::abs(this->c) + std::abs(this->d));
+
+    const bool
+            rotation   = std::abs(this->a - this->d) <= tolerance && std::abs(this->b + this->c) <= tolerance,
+            reflection = std::abs(this->a + this->d) <= tolerance && std::abs(this->b - this->c) <= tolerance;
+
+    return (rotation || reflection) && this->determinant() != 0;
+}
+
+AffineTransform::number_t AffineTransform::scaleFactor() const
+{
+    return std::sqrt(this->a * this->a + this->b * this->b);
+}
+
+void transformPoints(const AffineTransform& t,
+                     const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                     PathInterface::number_t* outX, PathInterface::number_t* outY)
+{
+    std::size_t i = 0;
+
+    if ( t.isScaleTranslate() ) {
+#if defined(__SSE2__)
+        const __m128d
+                a = _mm_set1_pd(t.a), d = _mm_set1_pd(t.d),
+                e = _mm_set1_pd(t.e), f = _mm_set1_pd(t.f);
+
+        for (; i + 2 <= n; i += 2) {
+            const __m128d
+                    x = _mm_loadu_pd(xs + i),
+                    y = _mm_loadu_pd(ys + i);
+            _mm_storeu_pd(outX + i, _mm_add_pd(_mm_mul_pd(a, x), e));
+            _mm_storeu_pd(outY + i, _mm_add_pd(_mm_mul_pd(d, y), f));
+        }
+#endif
+        for (; i < n; ++i) {
+            outX[i] = t.a * xs[i] + t.e;
+            outY[i] = t.d * ys[i] + t.f;
+        }
+        return;
+    }
+
+#if defined(__SSE2__)
+    const __m128d
+            a = _mm_set1_pd(t.a), b = _mm_set1_pd(t.b),
+            c = _mm_set1_pd(t.c), d = _mm_set1_pd(t.d),
+            e = _mm_set1_pd(t.e), f = _mm_set1_pd(t.f);
+
+    for (; i + 2 <= n; i += 2) {
+        const __m128d
+                x = _mm_loadu_pd(xs + i),
+                y = _mm_loadu_pd(ys + i);
+        _mm_storeu_pd(outX + i, _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, x), _mm_mul_pd(c, y)), e));
+        _mm_storeu_pd(outY + i, _mm_add_pd(_mm_add_pd(_mm_mul_pd(b, x), _mm_mul_pd(d, y)), f));
+    }
+#endif
+    for (; i < n; ++i) {
+        const PathInterface::number_t x = xs[i], y = ys[i];
+        outX[i] = t.a * x + t.c * y + t.e;
+        outY[i] = t.b * x + t.d * y + t.f;
+    }
+}
+
+} // namespace d3_path
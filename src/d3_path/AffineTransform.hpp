@@ -0,0 +1,65 @@
+#ifndef D3__PATH__AFFINE_TRANSFORM_HPP
+#define D3__PATH__AFFINE_TRANSFORM_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * 2×3 affine matrix in SVG / canvas order:
+ *
+ *     x' = a * x + c * y + e
+ *     y' = b * x + d * y + f
+ */
+struct AffineTransform
+{
+    using number_t = PathInterface::number_t;
+
+    number_t a, b, c, d, e, f;
+
+    AffineTransform(number_t a = 1, number_t b = 0, number_t c = 0, number_t d = 1, number_t e = 0, number_t f = 0);
+
+    static AffineTransform translate(number_t tx, number_t ty);
+    static AffineTransform scale(number_t sx, number_t sy);
+    static AffineTransform rotate(number_t angle);
+
+    /**
+     * Returns this ∘ other: applies `other` first, then this transform.
+     */
+    AffineTransform operator*(const AffineTransform& other) const;
+
+    /**
+     * No rotation or skew (b = c = 0); includes the identity.
+     */
+    bool isScaleTranslate() const { return this->b == 0 && this->c == 0; }
+
+    /**
+     * Uniform scale + rotation, possibly reflected: circles stay circles.
+     */
+    bool isSimilarity() const;
+
+    /**
+     * Uniform scale factor, √(a² + b²); meaningful for similarities only.
+     */
+    number_t scaleFactor() const;
+
+    number_t determinant() const { return this->a * this->d - this->b * this->c; }
+
+    number_t applyX(number_t x, number_t y) const { return this->a * x + this->c * y + this->e; }
+    number_t applyY(number_t x, number_t y) const { return this->b * x + this->d * y + this->f; }
+};
+
+/**
+ * Transforms `n` points given as separate x / y arrays into `outX` / `outY`
+ * (which may alias the inputs). Uses SSE2 when available, with a dedicated
+ * scale + translate loop for the common data-to-pixel case.
+ */
+void transformPoints(const AffineTransform& transform,
+                     const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                     PathInterface::number_t* outX, PathInterface::number_t* outY);
+
+} // namespace d3_path
+
+#endif // D3__PATH__AFFINE_TRANSFORM_HPP
@@ -0,0 +1,64 @@
+#include "d3_path/Arena.hpp"
+
+#include <cstdlib>   // for std::malloc(), std::free()
+#include <algorithm> // for std::max()
+
+namespace d3_path {
+
+Arena::Arena(std::size_t blockSize)
+    : _blocks( nullptr )
+    , _cursor( nullptr )
+    , _end( nullptr )
+    , _blockSize( blockSize )
+    , _allocated( 0 )
+{ }
+
+Arena::~Arena()
+{
+    this->release();
+}
+
+void* Arena::allocateBlock(std::size_t size, std::size_t align)
+{
+    // The header keeps the payload aligned for any fundamental type.
+    const std::size_t
+            header = (sizeof(Block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1),
+            payload = std::max(this->_blockSize, size + align);
+
+    Block* block = static_cast<Block*>(std::malloc(header + payload));
+    if (block == nullptr) throw std::bad_alloc();
+    block->size = payload;
+
+    char* begin = reinterpret_cast<char*>(block) + header;
+    char* p = reinterpret_cast<char*>((reinterpret_cast<std::size_t>(begin) + align - 1) & ~(align - 1));
+
+    if (payload - size - (p - begin) >= static_cast<std::size_t>(this->_end - this->_cursor)) {
+        // The new block has more room left than the current one: carry on from it.
+        block->next = this->_blocks;
+        this->_blocks = block;
+        this->_cursor = p + size;
+        this->_end = begin + payload;
+    }
+    else {
+        // An oversized one-off: keep filling the current block.
+        block->next = this->_blocks->next;
+        this->_blocks->next = block;
+    }
+
+    this->_allocated += size;
+    return p;
+}
+
+void Arena::release()
+{
+    for (Block* block = this->_blocks; block != nullptr;) {
+        Block* next = block->next;
+        std::free(block);
+        block = next;
+    }
+    this->_blocks = nullptr;
+    this->_cursor = this->_end = nullptr;
+    this->_allocated = 0;
+}
+
+} // namespace d3_path
@@ -0,0 +1,114 @@
+#ifndef D3__PATH__ARENA_HPP
+#define D3__PATH__ARENA_HPP
+
+#include <new>     // for ::operator new()
+#include <string>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * Monotonic memory: allocations are carved out of large blocks and only
+ * given back all at once, by release() or the destructor. One arena per
+ * request (or per thread) makes a batch of temporary paths free to tear
+ * down and keeps worker threads off the shared heap.
+ *
+ * Not thread-safe: each thread uses its own arena.
+ */
+class Arena
+{
+    struct Block {
+        Block*      next;
+        std::size_t size;
+    };
+
+    Block*      _blocks;
+    char*       _cursor;
+    char*       _end;
+    std::size_t _blockSize;
+    std::size_t _allocated;
+
+    void* allocateBlock(std::size_t size, std::size_t align);
+
+public:
+
+    /**
+     * Blocks are `blockSize` bytes; a larger request gets a block of its own.
+     */
+    explicit Arena(std::size_t blockSize = 64 * 1024);
+
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t align) {
+        char* p = reinterpret_cast<char*>((reinterpret_cast<std::size_t>(this->_cursor) + align - 1) & ~(align - 1));
+        // Aligning can step past the end of a block filled to an odd size.
+        if (this->_cursor == nullptr || p > this->_end || size > static_cast<std::size_t>(this->_end - p)) return this->allocateBlock(size, align);
+        this->_cursor = p + size;
+        this->_allocated += size;
+        return p;
+    }
+
+    /**
+     * Frees every block: everything allocated from this arena is gone.
+     */
+    void release();
+
+    /**
+     * Bytes handed out since construction or the last release().
+     */
+    std::size_t allocated() const { return this->_allocated; }
+};
+
+/**
+ * Standard allocator drawing from an Arena; deallocate() is a no-op. A
+ * default-constructed one (no arena) uses the global heap, so containers
+ * using it work the same with or without an arena.
+ */
+template <typename T>
+class ArenaAllocator
+{
+    Arena* _arena;
+
+public:
+
+    using value_type = T;
+
+    ArenaAllocator() noexcept
+        : _arena( nullptr )
+    { }
+
+    ArenaAllocator(Arena& arena) noexcept
+        : _arena( &arena )
+    { }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+        : _arena( other.arena() )
+    { }
+
+    Arena* arena() const noexcept { return this->_arena; }
+
+    T* allocate(std::size_t n) {
+        if (this->_arena == nullptr) return static_cast<T*>(::operator new(n * sizeof(T)));
+        return static_cast<T*>(this->_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        if (this->_arena == nullptr) ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept { return a.arena() == b.arena(); }
+
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) noexcept { return a.arena() != b.arena(); }
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+} // namespace d3_path
+
+#endif // D3__PATH__ARENA_HPP
@@ -0,0 +1,56 @@
+#include "d3_path/CairoPath.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+
+CairoPath::CairoPath(cairo_t* cr)
+    : _cr( cr )
+{ }
+
+void CairoPath::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    cairo_move_to(this->_cr, x, y);
+}
+
+void CairoPath::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    cairo_line_to(this->_cr, x, y);
+}
+
+void CairoPath::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    cairo_curve_to(this->_cr, x1, y1, x2, y2, x, y);
+}
+
+void CairoPath::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    if (da > 0) cairo_arc         (this->_cr, cx, cy, r, a0, a0 + da);
+    else        cairo_arc_negative(this->_cr, cx, cy, r, a0, a0 + da);
+}
+
+void CairoPath::emitClosePath()
+{
+    cairo_close_path(this->_cr);
+}
+
+void CairoPath::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    // move_to(x, y), then clockwise with relative lines and close_path, like Path.
+    cairo_rectangle(this->_cr, x, y, w, h);
+}
+
+void CairoPath::clear()
+{
+    cairo_new_path(this->_cr);
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+std::string CairoPath::toString() const
+{
+    return std::string();
+}
+
+} // namespace d3_path
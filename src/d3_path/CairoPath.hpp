@@ -0,0 +1,57 @@
+#ifndef D3__PATH__CAIRO_PATH_HPP
+#define D3__PATH__CAIRO_PATH_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+
+#include <cairo.h>
+
+namespace d3_path {
+
+/**
+ * A PathInterface that drives the path of a cairo_t directly, without
+ * going through SVG path data.
+ *
+ * arc and arcTo resolve exactly as in Path (d3's epsilon rules and tangent
+ * arcs, via PathNormalizer) and map onto cairo_arc / cairo_arc_negative,
+ * whose angles grow clockwise on screen like canvas angles; quadratic
+ * curves are elevated to cubics, rect maps onto cairo_rectangle.
+ * No text is produced: toString() returns an empty string.
+ *
+ * The context is borrowed, not owned. cairo_fill() and cairo_stroke()
+ * consume the cairo path: call clear() after them to start over here too.
+ */
+class CairoPath final : public PathNormalizer
+{
+    cairo_t* _cr;
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+    void emitRect(number_t x, number_t y, number_t w, number_t h) override;
+
+public:
+
+    explicit CairoPath(cairo_t* cr);
+
+    cairo_t* context() const { return this->_cr; }
+
+    /**
+     * Starts a new path (cairo_new_path), forgetting the current point.
+     */
+    void clear();
+
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__CAIRO_PATH_HPP
@@ -0,0 +1,72 @@
+#include "d3_path/Canvas.hpp"
+
+namespace d3_path {
+
+Canvas::Canvas(std::size_t width, std::size_t height, Color background)
+    : _width( width )
+    , _height( height )
+    , _pixels( 4 * width * height )
+{
+    this->fill(background);
+}
+
+Color Canvas::pixel(std::size_t x, std::size_t y) const
+{
+    const std::uint8_t* p = this->_pixels.data() + y * this->stride() + 4 * x;
+    return Color{p[0], p[1], p[2], p[3]};
+}
+
+void Canvas::fill(Color color)
+{
+    std::uint8_t* p = this->_pixels.data();
+    for (std::size_t i = 0, n = this->_width * this->_height; i < n; ++i, p += 4) {
+        p[0] = color.r;
+        p[1] = color.g;
+        p[2] = color.b;
+        p[3] = color.a;
+    }
+}
+
+void Canvas::blendSpan(std::size_t x, std::size_t y, const float* coverage, std::size_t n, Color color)
+{
+    std::uint8_t* p = this->_pixels.data() + y * this->stride() + 4 * x;
+
+    const float
+            alpha = color.a / 255.0f,
+            r = color.r,
+            g = color.g,
+            b = color.b;
+
+    for (std::size_t i = 0; i < n; ++i, p += 4) {
+        const float sa = alpha * coverage[i];
+        if (!(sa > 0)) continue;
+
+        // Opaque source: replace.
+        if (sa >= 1) {
+            p[0] = color.r;
+            p[1] = color.g;
+            p[2] = color.b;
+            p[3] = 255;
+            continue;
+        }
+
+        // Opaque destination (the usual chart background): plain lerp.
+        if (p[3] == 255) {
+            p[0] = static_cast<std::uint8_t>(p[0] + (r - p[0]) * sa + 0.5f);
+            p[1] = static_cast<std::uint8_t>(p[1] + (g - p[1]) * sa + 0.5f);
+            p[2] = static_cast<std::uint8_t>(p[2] + (b - p[2]) * sa + 0.5f);
+            continue;
+        }
+
+        const float
+                da = p[3] / 255.0f * (1 - sa),
+                oa = sa + da;
+
+        p[0] = static_cast<std::uint8_t>((r * sa + p[0] * da) / oa + 0.5f);
+        p[1] = static_cast<std::uint8_t>((g * sa + p[1] * da) / oa + 0.5f);
+        p[2] = static_cast<std::uint8_t>((b * sa + p[2] * da) / oa + 0.5f);
+        p[3] = static_cast<std::uint8_t>(oa * 255 + 0.5f);
+    }
+}
+
+} // namespace d3_path
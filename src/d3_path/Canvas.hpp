@@ -0,0 +1,55 @@
+#ifndef D3__PATH__CANVAS_HPP
+#define D3__PATH__CANVAS_HPP
+
+#include <vector>
+#include <cstdint> // for std::uint8_t
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * 8-bit RGBA color, straight (non-premultiplied) alpha.
+ */
+struct Color {
+    std::uint8_t r, g, b, a;
+};
+
+/**
+ * An RGBA8 pixel buffer: rows top to bottom, 4 bytes per pixel, no padding,
+ * straight alpha - the layout PNG and QOI expect.
+ */
+class Canvas
+{
+    std::size_t _width, _height;
+
+    std::vector<std::uint8_t> _pixels;
+
+public:
+
+    Canvas(std::size_t width, std::size_t height, Color background = Color{0, 0, 0, 0});
+
+    std::size_t width() const  { return this->_width; }
+    std::size_t height() const { return this->_height; }
+
+    /**
+     * Bytes per row.
+     */
+    std::size_t stride() const { return 4 * this->_width; }
+
+    std::uint8_t*       data()       { return this->_pixels.data(); }
+    const std::uint8_t* data() const { return this->_pixels.data(); }
+
+    Color pixel(std::size_t x, std::size_t y) const;
+
+    void fill(Color color);
+
+    /**
+     * Composites `color` over the `n` pixels starting at ⟨x, y⟩ (source-over),
+     * its alpha scaled by coverage[i] ∈ [0, 1]. The span must lie within one row.
+     */
+    void blendSpan(std::size_t x, std::size_t y, const float* coverage, std::size_t n, Color color);
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__CANVAS_HPP
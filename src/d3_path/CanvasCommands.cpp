@@ -0,0 +1,156 @@
+#include "d3_path/CanvasCommands.hpp"
+
+#include "d3_path/detail/fixed.hpp"
+#include "d3_path/detail/to_str.hpp"
+
+#include <stdexcept> // for std::runtime_error()
+#include <cstring>   // for std::memcmp(), std::memcpy()
+#include <cstdint>   // for std::uint8_t, std::uint32_t
+
+namespace d3_path {
+
+namespace {
+
+using Command = RecordedPath::Command;
+
+const std::size_t
+        HEADER_SIZE = 12,
+        BUFFER_SIZE = 1 << 16;
+
+const char MAGIC[4] = { 'd', '3', 'p', 'c' };
+
+std::size_t pad4(std::size_t n)
+{
+    return (n + 3) & ~std::size_t(3);
+}
+
+void putU32(std::string& out, std::uint32_t v)
+{
+    const char bytes[4] = {
+        static_cast<char>(v),
+        static_cast<char>(v >> 8),
+        static_cast<char>(v >> 16),
+        static_cast<char>(v >> 24),
+    };
+    out.append(bytes, 4);
+}
+
+std::uint32_t getU32(const std::uint8_t* in)
+{
+    return in[0] | (std::uint32_t(in[1]) << 8) | (std::uint32_t(in[2]) << 16) | (std::uint32_t(in[3]) << 24);
+}
+
+} // namespace
+
+void encodeCommands(const RecordedPath& path, Sink& sink)
+{
+    const RecordedPath::Commands& commands = path.commands();
+    const RecordedPath::Numbers&  numbers = path.numbers();
+
+    std::string buffer(MAGIC, sizeof(MAGIC));
+    buffer.reserve(BUFFER_SIZE);
+    putU32(buffer, static_cast<std::uint32_t>(commands.size()));
+    putU32(buffer, static_cast<std::uint32_t>(numbers.size()));
+
+    for (const Command command : commands) {
+        buffer += static_cast<char>(command);
+        if (buffer.size() >= BUFFER_SIZE) {
+            sink.write(buffer);
+            buffer.clear();
+        }
+    }
+    buffer.append(pad4(commands.size()) - commands.size(), '\0');
+
+    for (const PathInterface::number_t number : numbers) {
+        const float f = static_cast<float>(number);
+        std::uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        putU32(buffer, bits);
+        if (buffer.size() >= BUFFER_SIZE) {
+            sink.write(buffer);
+            buffer.clear();
+        }
+    }
+
+    sink.write(buffer);
+}
+
+RecordedPath decodeCommands(const char* data, std::size_t size)
+{
+    const std::uint8_t* in = reinterpret_cast<const std::uint8_t*>(data);
+
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("invalid command data: missing header");
+    }
+
+    const std::size_t
+            commands = getU32(in + 4),
+            numbers = getU32(in + 8),
+            expected = HEADER_SIZE + pad4(commands) + 4 * numbers;
+    if (size != expected) {
+        throw std::runtime_error("invalid command data: expected " + detail::to_str(expected) + " bytes, got " + detail::to_str(size));
+    }
+
+    const std::uint8_t* ops = in + HEADER_SIZE;
+    const std::uint8_t* args = ops + pad4(commands);
+
+    RecordedPath path;
+    PathInterface::number_t values[6];
+    std::size_t used = 0;
+
+    for (std::size_t i = 0; i < commands; ++i) {
+        if (ops[i] > static_cast<std::uint8_t>(Command::Rect)) {
+            throw std::runtime_error("invalid command data: unknown opcode " + detail::to_str(int(ops[i])));
+        }
+
+        const Command command = static_cast<Command>(ops[i]);
+        const std::size_t n = RecordedPath::arity(command);
+        if (used + n > numbers) throw std::runtime_error("invalid command data: missing arguments");
+
+        for (std::size_t k = 0; k < n; ++k, ++used) {
+            const std::uint32_t bits = getU32(args + 4 * used);
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            values[k] = f;
+        }
+        RecordedPath::replay(command, values, path);
+    }
+
+    if (used != numbers) throw std::runtime_error("invalid command data: unused arguments");
+
+    return path;
+}
+
+void encodeCommandsJson(const RecordedPath& path, Sink& sink, int precision)
+{
+    if (precision < 0) precision = 0;
+    if (precision > detail::MAX_FIXED_PRECISION) precision = detail::MAX_FIXED_PRECISION;
+
+    std::string buffer = "[";
+    buffer.reserve(BUFFER_SIZE);
+
+    const PathInterface::number_t* args = path.numbers().data();
+    bool first = true;
+    for (const Command command : path.commands()) {
+        if (!first) buffer += ',';
+        first = false;
+        buffer += static_cast<char>('0' + static_cast<int>(command));
+
+        const std::size_t n = RecordedPath::arity(command);
+        for (std::size_t k = 0; k < n; ++k) {
+            buffer += ',';
+            detail::appendFixed(buffer, args[k], precision);
+        }
+        args += n;
+
+        if (buffer.size() >= BUFFER_SIZE) {
+            sink.write(buffer);
+            buffer.clear();
+        }
+    }
+    buffer += ']';
+
+    sink.write(buffer);
+}
+
+} // namespace d3_path
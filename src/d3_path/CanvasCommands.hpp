@@ -0,0 +1,36 @@
+#ifndef D3__PATH__CANVAS_COMMANDS_HPP
+#define D3__PATH__CANVAS_COMMANDS_HPP
+
+#include "d3_path/RecordedPath.hpp"
+#include "d3_path/Sink.hpp"
+
+namespace d3_path {
+
+/**
+ * Encodes the calls of `path` for replay on a browser <canvas> by
+ * src/js/d3-path-replay.js, without parsing path data. Little-endian:
+ *
+ *     "d3pc"  u32 commands  u32 numbers
+ *     commands × u8 opcode (RecordedPath::Command), zero-padded to 4 bytes
+ *     numbers × f32 arguments, in call order
+ *
+ * so the replayer views both arrays in place (Uint8Array, Float32Array).
+ */
+void encodeCommands(const RecordedPath& path, Sink& sink);
+
+/**
+ * Decodes the output of encodeCommands(), arguments rounded to float.
+ * Throws std::runtime_error on malformed input.
+ */
+RecordedPath decodeCommands(const char* data, std::size_t size);
+
+/**
+ * Encodes the calls of `path` as a flat JSON array, each opcode followed by
+ * its arguments: [0,10,20,2,30,40,1] is moveTo(10, 20), lineTo(30, 40),
+ * closePath(). Numbers have at most `precision` (0 … 6) decimals.
+ */
+void encodeCommandsJson(const RecordedPath& path, Sink& sink, int precision = 3);
+
+} // namespace d3_path
+
+#endif // D3__PATH__CANVAS_COMMANDS_HPP
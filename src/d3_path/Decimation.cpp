@@ -0,0 +1,200 @@
+#include "d3_path/Decimation.hpp"
+
+#include "d3_path/detail/parallel.hpp"
+
+#include <algorithm> // for std::partition_point(), std::sort(), std::min()
+#include <cmath>     // for std::abs(), std::floor()
+
+namespace d3_path {
+
+namespace {
+
+using number_t = PathInterface::number_t;
+
+using detail::parallelFor;
+using detail::resolveThreads;
+
+void appendRanges(std::vector<std::size_t>& indices, const std::vector<std::vector<std::size_t>>& ranges)
+{
+    for (const std::vector<std::size_t>& range : ranges) {
+        indices.insert(indices.end(), range.begin(), range.end());
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+struct Columns
+{
+    number_t    xMin, scale;
+    std::size_t width;
+
+    std::size_t operator()(number_t x) const {
+        const number_t c = (x - this->xMin) * this->scale;
+        if (!(c > 0)) return 0;
+        if (c >= this->width) return this->width - 1;
+        return static_cast<std::size_t>(c);
+    }
+};
+
+void m4Range(const number_t* xs, const number_t* ys, std::size_t begin, std::size_t end,
+             const Columns& columnOf, std::vector<std::size_t>& out)
+{
+    if (begin >= end) return;
+
+    std::size_t column = columnOf(xs[begin]);
+    std::size_t first = begin, last = begin, min = begin, max = begin;
+
+    const auto flush = [&]() {
+        std::size_t keep[4] = { first, min, max, last };
+        std::sort(keep, keep + 4);
+        out.push_back(keep[0]);
+        for (int k = 1; k < 4; ++k) {
+            if (keep[k] != keep[k - 1]) out.push_back(keep[k]);
+        }
+    };
+
+    for (std::size_t i = begin + 1; i < end; ++i) {
+        const std::size_t c = columnOf(xs[i]);
+        if (c != column) {
+            flush();
+            column = c;
+            first = last = min = max = i;
+        }
+        else {
+            last = i;
+            if (ys[i] < ys[min]) min = i;
+            if (ys[i] > ys[max]) max = i;
+        }
+    }
+
+    flush();
+}
+
+// -----------------------------------------------------------------------------
+
+// Selects one point per bucket for buckets [bucketBegin, bucketEnd), starting from `anchor`.
+void lttbRange(const number_t* xs, const number_t* ys, std::size_t n, number_t every,
+               std::size_t bucketBegin, std::size_t bucketEnd, std::size_t anchor,
+               std::vector<std::size_t>& out)
+{
+    std::size_t a = anchor;
+
+    for (std::size_t i = bucketBegin; i < bucketEnd; ++i) {
+        // Centroid of the next bucket.
+        const std::size_t
+                avgBegin = static_cast<std::size_t>(std::floor((i + 1) * every)) + 1,
+                avgEnd   = std::min(static_cast<std::size_t>(std::floor((i + 2) * every)) + 1, n);
+
+        number_t avgX = 0, avgY = 0;
+        for (std::size_t j = avgBegin; j < avgEnd; ++j) {
+            avgX += xs[j];
+            avgY += ys[j];
+        }
+        avgX /= (avgEnd - avgBegin);
+        avgY /= (avgEnd - avgBegin);
+
+        // Point of the current bucket forming the largest triangle.
+        const std::size_t
+                begin = static_cast<std::size_t>(std::floor(i * every)) + 1,
+                end   = static_cast<std::size_t>(std::floor((i + 1) * every)) + 1;
+
+        const number_t ax = xs[a], ay = ys[a];
+
+        number_t    maxArea = -1;
+        std::size_t next = begin;
+        for (std::size_t j = begin; j < end; ++j) {
+            const number_t area = std::abs((ax - avgX) * (ys[j] - ay) - (ax - xs[j]) * (avgY - ay));
+            if (area > maxArea) {
+                maxArea = area;
+                next = j;
+            }
+        }
+
+        out.push_back(a = next);
+    }
+}
+
+} // namespace
+
+void decimateM4(const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                PathInterface::number_t xMin, PathInterface::number_t xMax, std::size_t width,
+                std::vector<std::size_t>& indices, unsigned threads)
+{
+    if (n == 0 || width == 0) return;
+
+    const Columns columnOf = { xMin, (xMax > xMin) ? width / (xMax - xMin) : 0, width };
+
+    threads = static_cast<unsigned>( std::min<std::size_t>(resolveThreads(threads), width) );
+    if (threads == 1) {
+        m4Range(xs, ys, 0, n, columnOf, indices);
+        return;
+    }
+
+    // Split by columns, so no column straddles two ranges.
+    std::vector<std::vector<std::size_t>> ranges(threads);
+    parallelFor(threads, [&](unsigned k) {
+        const std::size_t
+                c0 = width * k / threads,
+                c1 = width * (k + 1) / threads;
+        const auto before = [&](std::size_t c) {
+            return [&columnOf, c](number_t x) { return columnOf(x) < c; };
+        };
+        const std::size_t
+                begin = std::partition_point(xs, xs + n, before(c0)) - xs,
+                end   = (k + 1 == threads) ? n : std::partition_point(xs, xs + n, before(c1)) - xs;
+
+        m4Range(xs, ys, begin, end, columnOf, ranges[k]);
+    });
+
+    appendRanges(indices, ranges);
+}
+
+void decimateLttb(const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                  std::size_t threshold,
+                  std::vector<std::size_t>& indices, unsigned threads)
+{
+    if (threshold >= n || threshold < 3) {
+        for (std::size_t i = 0; i < n; ++i) indices.push_back(i);
+        return;
+    }
+
+    const std::size_t buckets = threshold - 2;
+    const number_t every = static_cast<number_t>(n - 2) / buckets;
+
+    indices.push_back(0);
+
+    threads = static_cast<unsigned>( std::min<std::size_t>(resolveThreads(threads), buckets) );
+    if (threads == 1) {
+        lttbRange(xs, ys, n, every, 0, buckets, 0, indices);
+    }
+    else {
+        std::vector<std::vector<std::size_t>> ranges(threads);
+        parallelFor(threads, [&](unsigned k) {
+            const std::size_t
+                    b0 = buckets * k / threads,
+                    b1 = buckets * (k + 1) / threads;
+            // Last point of the previous bucket stands in for its (unknown) selection.
+            const std::size_t anchor = static_cast<std::size_t>(std::floor(b0 * every));
+
+            ranges[k].reserve(b1 - b0);
+            lttbRange(xs, ys, n, every, b0, b1, anchor, ranges[k]);
+        });
+        appendRanges(indices, ranges);
+    }
+
+    indices.push_back(n - 1);
+}
+
+void drawIndices(PathInterface& path,
+                 const PathInterface::number_t* xs, const PathInterface::number_t* ys,
+                 const std::vector<std::size_t>& indices)
+{
+    if (indices.empty()) return;
+
+    path.moveTo(xs[indices.front()], ys[indices.front()]);
+    for (std::size_t k = 1; k < indices.size(); ++k) {
+        path.lineTo(xs[indices[k]], ys[indices[k]]);
+    }
+}
+
+} // namespace d3_path
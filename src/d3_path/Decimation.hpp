@@ -0,0 +1,53 @@
+#ifndef D3__PATH__DECIMATION_HPP
+#define D3__PATH__DECIMATION_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * Time-series decimation for line charts. All functions take x-sorted
+ * structure-of-arrays input (`xs`, `ys`, `n` points) and append the indices
+ * of the points to keep, in increasing order, to `indices`.
+ *
+ * `threads` splits the work into contiguous ranges processed in parallel;
+ * 0 means std::thread::hardware_concurrency().
+ */
+
+/**
+ * M4 aggregation: maps [xMin, xMax] onto `width` pixel columns and keeps the
+ * first, last, minimum and maximum point of every column. The resulting
+ * polyline rasterizes identically to the full series at that width.
+ * Single pass; the result does not depend on `threads`.
+ */
+void decimateM4(const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                PathInterface::number_t xMin, PathInterface::number_t xMax, std::size_t width,
+                std::vector<std::size_t>& indices, unsigned threads = 1);
+
+/**
+ * Largest-Triangle-Three-Buckets: keeps `threshold` points (first and last
+ * included), choosing in every bucket the point forming the largest triangle
+ * with the previously kept point and the next bucket's centroid. Lossy, but
+ * visually close with far fewer points than M4.
+ *
+ * With `threads` > 1 the buckets are split into ranges; each range starts
+ * from its own boundary point, so results may differ slightly from the
+ * sequential algorithm at range boundaries.
+ */
+void decimateLttb(const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n,
+                  std::size_t threshold,
+                  std::vector<std::size_t>& indices, unsigned threads = 1);
+
+/**
+ * Draws the selected points as a polyline: moveTo the first one, lineTo the rest.
+ */
+void drawIndices(PathInterface& path,
+                 const PathInterface::number_t* xs, const PathInterface::number_t* ys,
+                 const std::vector<std::size_t>& indices);
+
+} // namespace d3_path
+
+#endif // D3__PATH__DECIMATION_HPP
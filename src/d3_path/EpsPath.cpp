@@ -0,0 +1,200 @@
+#include "d3_path/EpsPath.hpp"
+
+#include "d3_path/detail/constants.hpp"
+#include "d3_path/detail/fixed.hpp"
+
+#include <cmath>     // for std::ceil()
+#include <algorithm> // for std::min()
+#include <stdexcept> // for std::runtime_error()
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+using detail::pi;
+
+namespace {
+
+const std::size_t BLOCK_SIZE = 1 << 16;
+
+// Operator aliases, private to the figure's dictionary.
+const char* const PROLOG =
+    "%%BeginProlog\n"
+    "/d3path 16 dict def\n"
+    "d3path begin\n"
+    "/m /moveto load def\n"
+    "/l /lineto load def\n"
+    "/c /curveto load def\n"
+    "/h /closepath load def\n"
+    "/a /arc load def\n"
+    "/an /arcn load def\n"
+    "/re { 4 2 roll moveto 1 index 0 rlineto 0 exch rlineto neg 0 rlineto closepath } bind def\n"
+    "/f /fill load def\n"
+    "/ef /eofill load def\n"
+    "/s /stroke load def\n"
+    "/rg /setrgbcolor load def\n"
+    "/w /setlinewidth load def\n"
+    "end\n"
+    "%%EndProlog\n";
+
+} // namespace
+
+EpsPath::EpsPath(Sink& sink, PathInterface::number_t width, PathInterface::number_t height, int precision)
+    : _sink( sink )
+    , _precision( precision < 0 ? 0 : precision > detail::MAX_FIXED_PRECISION ? detail::MAX_FIXED_PRECISION : precision )
+    , _finished( false )
+    , _fill{ 0, 0, 0 }
+    , _stroke{ 0, 0, 0 }
+    , _color{ 0, 0, 0 }
+{
+    this->_buffer = "%!PS-Adobe-3.0 EPSF-3.0\n%%BoundingBox: 0 0 ";
+    this->put(std::ceil(width), 0);
+    this->put(std::ceil(height), 0);
+    this->_buffer += "\n%%HiResBoundingBox: 0 0 ";
+    this->put(width);
+    this->put(height);
+    this->_buffer += "\n%%Creator: d3-path\n%%LanguageLevel: 2\n%%Pages: 1\n%%EndComments\n";
+    this->_buffer += PROLOG;
+
+    // Flip to y-down page coordinates.
+    this->_buffer += "%%Page: 1 1\nd3path begin\n0 ";
+    this->put(height);
+    this->put("translate 1 -1 scale");
+}
+
+void EpsPath::put(PathInterface::number_t value, int precision)
+{
+    detail::appendFixed(this->_buffer, value, precision);
+    this->_buffer += ' ';
+}
+
+void EpsPath::put(const char* op)
+{
+    this->_buffer += op;
+    this->_buffer += '\n';
+    if (this->_buffer.size() >= BLOCK_SIZE) {
+        this->_sink.write(this->_buffer);
+        this->_buffer.clear();
+    }
+}
+
+void EpsPath::requireOpen() const
+{
+    if (this->_finished) throw std::runtime_error("EpsPath: figure already finished");
+}
+
+void EpsPath::useColor(const PathInterface::number_t* rgb)
+{
+    if (rgb[0] == this->_color[0] && rgb[1] == this->_color[1] && rgb[2] == this->_color[2]) return;
+
+    for (int i = 0; i < 3; ++i) {
+        this->_color[i] = rgb[i];
+        this->put(rgb[i]);
+    }
+    this->put("rg");
+}
+
+void EpsPath::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requireOpen();
+    this->put(x); this->put(y);
+    this->put("m");
+}
+
+void EpsPath::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requireOpen();
+    this->put(x); this->put(y);
+    this->put("l");
+}
+
+void EpsPath::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requireOpen();
+    this->put(x1); this->put(y1);
+    this->put(x2); this->put(y2);
+    this->put(x);  this->put(y);
+    this->put("c");
+}
+
+void EpsPath::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    // In the flipped space, arc turns clockwise on screen: positive sweeps.
+    const number_t deg = 180 / pi;
+    const int precision = std::min(this->_precision + 2, detail::MAX_FIXED_PRECISION);
+
+    this->requireOpen();
+    this->put(cx); this->put(cy); this->put(r);
+    this->put(a0 * deg, precision);
+    this->put((a0 + da) * deg, precision);
+    this->put(da > 0 ? "a" : "an");
+}
+
+void EpsPath::emitClosePath()
+{
+    this->requireOpen();
+    this->put("h");
+}
+
+void EpsPath::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    // The prolog's re: moveto, then clockwise with relative lines and closepath, like Path.
+    this->requireOpen();
+    this->put(x); this->put(y);
+    this->put(w); this->put(h);
+    this->put("re");
+}
+
+void EpsPath::setFillColor(PathInterface::number_t r, PathInterface::number_t g, PathInterface::number_t b)
+{
+    this->_fill[0] = r;
+    this->_fill[1] = g;
+    this->_fill[2] = b;
+}
+
+void EpsPath::setStrokeColor(PathInterface::number_t r, PathInterface::number_t g, PathInterface::number_t b)
+{
+    this->_stroke[0] = r;
+    this->_stroke[1] = g;
+    this->_stroke[2] = b;
+}
+
+void EpsPath::setLineWidth(PathInterface::number_t width)
+{
+    this->requireOpen();
+    this->put(width);
+    this->put("w");
+}
+
+void EpsPath::fill(FillRule rule)
+{
+    this->requireOpen();
+    this->useColor(this->_fill);
+    this->put(rule == FillRule::EvenOdd ? "ef" : "f");
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+void EpsPath::stroke()
+{
+    this->requireOpen();
+    this->useColor(this->_stroke);
+    this->put("s");
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+void EpsPath::finish()
+{
+    if (this->_finished) return;
+
+    this->_buffer += "end\nshowpage\n%%Trailer\n%%EOF\n";
+    this->_sink.write(this->_buffer);
+    this->_buffer.clear();
+
+    this->_finished = true;
+}
+
+std::string EpsPath::toString() const
+{
+    return std::string();
+}
+
+} // namespace d3_path
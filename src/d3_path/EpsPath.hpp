@@ -0,0 +1,92 @@
+#ifndef D3__PATH__EPS_PATH_HPP
+#define D3__PATH__EPS_PATH_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+#include "d3_path/FillRule.hpp"
+#include "d3_path/Sink.hpp"
+
+namespace d3_path {
+
+/**
+ * A PathInterface that writes an Encapsulated PostScript figure to a Sink.
+ *
+ * The prolog defines one- and two-letter aliases for the path and paint
+ * operators (m l c h re a an f ef s rg w) in a private dictionary, so each
+ * segment costs a few bytes. arc maps to the native arc / arcn operators:
+ * the page is flipped to y-down coordinates, so angles keep d3's meaning
+ * (radians from the positive x axis, clockwise on screen) and are written
+ * in degrees with two extra decimals. Quadratic curves become cubics.
+ *
+ * Numbers are fixed-point with `precision` decimals, trailing zeros
+ * dropped. Output goes to the sink in blocks; call finish() to write the
+ * trailer. No text is produced: toString() returns an empty string.
+ */
+class EpsPath final : public PathNormalizer
+{
+    Sink& _sink;
+    int   _precision;
+    bool  _finished;
+
+    std::string _buffer; // pending output, handed to the sink in blocks
+
+    // PostScript has one current color: fill() and stroke() switch to theirs when needed.
+    number_t _fill[3], _stroke[3], _color[3];
+
+    void useColor(const number_t* rgb);
+
+    void put(number_t value, int precision);
+
+    void put(number_t value) { this->put(value, this->_precision); }
+
+    void put(const char* op);
+
+    void requireOpen() const;
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+    void emitRect(number_t x, number_t y, number_t w, number_t h) override;
+
+public:
+
+    /**
+     * Writes the header and prolog of a `width` × `height` points figure.
+     */
+    EpsPath(Sink& sink, number_t width, number_t height, int precision = 2);
+
+    EpsPath(const EpsPath&) = delete;
+    EpsPath& operator=(const EpsPath&) = delete;
+
+    void setFillColor(number_t r, number_t g, number_t b);
+
+    void setStrokeColor(number_t r, number_t g, number_t b);
+
+    void setLineWidth(number_t width);
+
+    /**
+     * Paint the current path, which is then reset.
+     */
+    void fill(FillRule rule = FillRule::NonZero);
+
+    void stroke();
+
+    /**
+     * Writes the trailer and flushes to the sink. Drawing afterwards throws.
+     */
+    void finish();
+
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__EPS_PATH_HPP
@@ -0,0 +1,18 @@
+#ifndef D3__PATH__FILL_RULE_HPP
+#define D3__PATH__FILL_RULE_HPP
+
+namespace d3_path {
+
+/**
+ * Which points are inside a path, from the winding number w of the
+ * contours around them: w ≠ 0 (NonZero) or w odd (EvenOdd) - as in
+ * canvas fill() and SVG fill-rule.
+ */
+enum class FillRule {
+    NonZero,
+    EvenOdd,
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__FILL_RULE_HPP
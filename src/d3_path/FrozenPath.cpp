@@ -0,0 +1,27 @@
+#include "d3_path/FrozenPath.hpp"
+
+#include <utility> // for std::move()
+
+namespace d3_path {
+
+FrozenPath::FrozenPath(std::string bytes)
+{
+    if (bytes.empty()) return;
+
+    const std::size_t hash = std::hash<std::string>()(bytes);
+    this->_data = std::make_shared<const Data>( Data{ std::move(bytes), hash } );
+}
+
+const std::string& FrozenPath::str() const
+{
+    static const std::string empty;
+    return this->_data ? this->_data->bytes : empty;
+}
+
+bool FrozenPath::operator==(const FrozenPath& other) const
+{
+    if (this->_data == other._data) return true;
+    return this->hash() == other.hash() && this->str() == other.str();
+}
+
+} // namespace d3_path
@@ -0,0 +1,74 @@
+#ifndef D3__PATH__FROZEN_PATH_HPP
+#define D3__PATH__FROZEN_PATH_HPP
+
+#include <memory>
+#include <string>
+#include <cstddef>    // for std::size_t
+#include <functional> // for std::hash
+
+#if __cplusplus >= 201703L
+#  include <string_view>
+#endif
+
+namespace d3_path {
+
+/**
+ * An immutable snapshot of serialized path data (see BasicPath::freeze()).
+ * Copies share the data through an atomic reference count: any number of
+ * threads can hold and read the same snapshot without locks or copying.
+ * The hash is computed once, when the snapshot is made.
+ */
+class FrozenPath
+{
+    struct Data {
+        std::string bytes;
+        std::size_t hash;
+    };
+
+    std::shared_ptr<const Data> _data; // nullptr when empty
+
+public:
+
+    FrozenPath() = default;
+
+    explicit FrozenPath(std::string bytes);
+
+    const char* data() const { return this->_data ? this->_data->bytes.data() : ""; }
+
+    std::size_t size() const { return this->_data ? this->_data->bytes.size() : 0; }
+
+    bool empty() const { return this->size() == 0; }
+
+    /**
+     * The data as a string: a reference, not a copy.
+     */
+    const std::string& str() const;
+
+#if __cplusplus >= 201703L
+    std::string_view view() const { return std::string_view(this->data(), this->size()); }
+#endif
+
+    std::size_t hash() const { return this->_data ? this->_data->hash : std::hash<std::string>()(std::string()); }
+
+    /**
+     * Number of FrozenPath objects sharing this snapshot's data.
+     */
+    long useCount() const { return this->_data.use_count(); }
+
+    bool operator==(const FrozenPath& other) const;
+
+    bool operator!=(const FrozenPath& other) const { return !(*this == other); }
+};
+
+} // namespace d3_path
+
+namespace std {
+
+template <>
+struct hash<d3_path::FrozenPath> {
+    std::size_t operator()(const d3_path::FrozenPath& path) const { return path.hash(); }
+};
+
+} // namespace std
+
+#endif // D3__PATH__FROZEN_PATH_HPP
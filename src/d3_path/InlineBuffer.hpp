@@ -0,0 +1,138 @@
+#ifndef D3__PATH__INLINE_BUFFER_HPP
+#define D3__PATH__INLINE_BUFFER_HPP
+
+#include <new>       // for std::bad_alloc
+#include <cstdlib>   // for std::malloc(), std::realloc(), std::free()
+#include <cstring>   // for std::memcpy()
+#include <cstddef>   // for std::size_t
+#include <utility>   // for std::move()
+#include <algorithm> // for std::max()
+
+namespace d3_path {
+
+/**
+ * Path data stored in the object itself up to `N` bytes, on the heap
+ * beyond: symbol-sized paths (markers, ticks, a rect) never allocate.
+ *
+ * A Buffer for BasicPath (see InlinePath).
+ */
+template <std::size_t N>
+class InlineBuffer
+{
+    static_assert(N > 0, "InlineBuffer needs an inline capacity");
+
+    char*       _data;
+    std::size_t _size;
+    std::size_t _capacity;
+    char        _inline[N];
+
+    bool onHeap() const { return this->_data != this->_inline; }
+
+    void reallocate(std::size_t capacity) {
+        char* data = static_cast<char*>(this->onHeap() ? std::realloc(this->_data, capacity) : std::malloc(capacity));
+        if (data == nullptr) throw std::bad_alloc();
+        if (!this->onHeap()) std::memcpy(data, this->_inline, this->_size);
+        this->_data = data;
+        this->_capacity = capacity;
+    }
+
+public:
+
+    InlineBuffer()
+        : _data( _inline )
+        , _size( 0 )
+        , _capacity( N )
+    { }
+
+    InlineBuffer(const InlineBuffer& other)
+        : InlineBuffer()
+    {
+        this->append(other._data, other._size);
+    }
+
+    InlineBuffer(InlineBuffer&& other)
+        : InlineBuffer()
+    {
+        *this = std::move(other);
+    }
+
+    InlineBuffer& operator=(const InlineBuffer& other) {
+        if (this != &other) {
+            this->_size = 0;
+            this->append(other._data, other._size);
+        }
+        return *this;
+    }
+
+    InlineBuffer& operator=(InlineBuffer&& other) {
+        if (this == &other) return *this;
+
+        if (other.onHeap()) {
+            if (this->onHeap()) std::free(this->_data);
+            this->_data = other._data;
+            this->_size = other._size;
+            this->_capacity = other._capacity;
+            other._data = other._inline;
+            other._capacity = N;
+        }
+        else {
+            this->_size = 0;
+            this->append(other._data, other._size);
+        }
+        other._size = 0;
+        return *this;
+    }
+
+    ~InlineBuffer() {
+        if (this->onHeap()) std::free(this->_data);
+    }
+
+    void append(const char* data, std::size_t size) {
+        if (this->_size + size > this->_capacity) {
+            // `data` may point into this buffer: keep it valid across the move.
+            const bool aliased = data >= this->_data && data < this->_data + this->_size;
+            const std::size_t offset = aliased ? static_cast<std::size_t>(data - this->_data) : 0;
+            this->reallocate(std::max(this->_size + size, 2 * this->_capacity));
+            if (aliased) data = this->_data + offset;
+        }
+        std::memcpy(this->_data + this->_size, data, size);
+        this->_size += size;
+    }
+
+    const char* data() const { return this->_data; }
+
+    std::size_t size() const { return this->_size; }
+
+    std::size_t capacity() const { return this->_capacity; }
+
+    /**
+     * Whether the data still fits in the object itself.
+     */
+    bool inlined() const { return !this->onHeap(); }
+
+    /**
+     * Empties the buffer, keeping its capacity.
+     */
+    void clear() { this->_size = 0; }
+
+    /**
+     * Moves the data back inline when it fits, or trims the heap block.
+     */
+    void shrink_to_fit() {
+        if (!this->onHeap() || this->_size == this->_capacity) return;
+
+        if (this->_size <= N) {
+            std::memcpy(this->_inline, this->_data, this->_size);
+            std::free(this->_data);
+            this->_data = this->_inline;
+            this->_capacity = N;
+        }
+        else {
+            this->reallocate(this->_size);
+        }
+    }
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__INLINE_BUFFER_HPP
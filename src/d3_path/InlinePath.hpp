@@ -0,0 +1,24 @@
+#ifndef D3__PATH__INLINE_PATH_HPP
+#define D3__PATH__INLINE_PATH_HPP
+
+#include "d3_path/Path.hpp"
+#include "d3_path/InlineBuffer.hpp"
+#include "d3_path/detail/basic_path.hpp"
+
+namespace d3_path {
+
+/**
+ * A Path keeping up to `N` bytes in the object itself, for markers and
+ * other symbol-sized paths. Path.cpp instantiates N = 64, 128 and 256;
+ * other sizes are instantiated where they are used.
+ */
+template <std::size_t N>
+using InlinePath = BasicPath<InlineBuffer<N>>;
+
+extern template class BasicPath<InlineBuffer<64>>;
+extern template class BasicPath<InlineBuffer<128>>;
+extern template class BasicPath<InlineBuffer<256>>;
+
+} // namespace d3_path
+
+#endif // D3__PATH__INLINE_PATH_HPP
@@ -0,0 +1,136 @@
+#include "d3_path/MappedFile.hpp"
+
+#include "d3_path/detail/basic_path.hpp"
+
+#include <cerrno>    // for errno
+#include <algorithm> // for std::max()
+#include <stdexcept> // for std::runtime_error()
+#include <fcntl.h>    // for ::open(), ::posix_fallocate()
+#include <unistd.h>   // for ::ftruncate(), ::close(), ::sysconf()
+#include <sys/mman.h> // for ::mmap(), ::mremap(), ::munmap(), ::madvise()
+
+namespace d3_path {
+
+namespace {
+
+std::runtime_error error(const char* what, int code)
+{
+    return std::runtime_error(std::string(what) + ": " + std::strerror(code));
+}
+
+} // namespace
+
+const std::size_t MappedFile::DEFAULT_EXTENT;
+
+MappedFile::MappedFile()
+    : _fd( -1 )
+    , _data( nullptr )
+    , _size( 0 )
+    , _capacity( 0 )
+    , _extent( DEFAULT_EXTENT )
+{ }
+
+MappedFile::MappedFile(const std::string& filename, std::size_t extent)
+    : _fd( ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666) )
+    , _data( nullptr )
+    , _size( 0 )
+    , _capacity( 0 )
+    , _extent( extent )
+{
+    if (this->_fd < 0) throw std::runtime_error("cannot open file: " + filename);
+
+    // Extents are whole pages.
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    this->_extent = std::max(page, (extent + page - 1) / page * page);
+}
+
+MappedFile::MappedFile(MappedFile&& other)
+    : _fd( other._fd )
+    , _data( other._data )
+    , _size( other._size )
+    , _capacity( other._capacity )
+    , _extent( other._extent )
+{
+    other._fd = -1;
+    other._data = nullptr;
+    other._size = other._capacity = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+    if (this != &other) {
+        try { this->close(); } catch (...) { }
+
+        this->_fd = other._fd;
+        this->_data = other._data;
+        this->_size = other._size;
+        this->_capacity = other._capacity;
+        this->_extent = other._extent;
+
+        other._fd = -1;
+        other._data = nullptr;
+        other._size = other._capacity = 0;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    try { this->close(); } catch (...) { }
+}
+
+void MappedFile::grow(std::size_t size)
+{
+    if (this->_fd < 0) throw std::runtime_error("file is closed");
+
+    std::size_t capacity = this->_capacity + this->_extent;
+    if (capacity < size) capacity = (size + this->_extent - 1) / this->_extent * this->_extent;
+
+    // Reserve the blocks, so running out of disk is an error here rather
+    // than a SIGBUS on a later store; fall back to a sparse extension on
+    // file systems without fallocate.
+    const int reserved = ::posix_fallocate(this->_fd, static_cast<off_t>(this->_capacity), static_cast<off_t>(capacity - this->_capacity));
+    if (reserved == EINVAL || reserved == EOPNOTSUPP) {
+        if (::ftruncate(this->_fd, static_cast<off_t>(capacity)) != 0) throw error("cannot grow file", errno);
+    }
+    else if (reserved != 0) {
+        throw error("cannot grow file", reserved);
+    }
+
+    void* data;
+#ifdef __linux__
+    data = (this->_data == nullptr)
+            ? ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0)
+            : ::mremap(this->_data, this->_capacity, capacity, MREMAP_MAYMOVE);
+#else
+    if (this->_data != nullptr) ::munmap(this->_data, this->_capacity);
+    this->_data = nullptr;
+    data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+#endif
+    if (data == MAP_FAILED) throw error("cannot map file", errno);
+
+    ::madvise(data, capacity, MADV_SEQUENTIAL);
+
+    this->_data = static_cast<char*>(data);
+    this->_capacity = capacity;
+}
+
+void MappedFile::close()
+{
+    if (this->_fd < 0) return;
+
+    int failure = 0;
+    if (this->_data != nullptr && ::munmap(this->_data, this->_capacity) != 0) failure = errno;
+    if (::ftruncate(this->_fd, static_cast<off_t>(this->_size)) != 0 && failure == 0) failure = errno;
+    if (::close(this->_fd) != 0 && failure == 0) failure = errno;
+
+    this->_fd = -1;
+    this->_data = nullptr;
+    this->_size = this->_capacity = 0;
+
+    if (failure != 0) throw error("cannot close file", failure);
+}
+
+template class BasicPath<MappedFile>;
+
+} // namespace d3_path
@@ -0,0 +1,124 @@
+#ifndef D3__PATH__MAPPED_FILE_HPP
+#define D3__PATH__MAPPED_FILE_HPP
+
+#include "d3_path/Path.hpp"
+#include "d3_path/Sink.hpp"
+
+#include <string>
+#include <cstring> // for std::memcpy()
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * An output file written through a shared memory mapping, grown in large
+ * extents (reserved on disk up front, so a full disk throws instead of
+ * faulting) and advised for sequential access. Data goes straight into
+ * the page cache: no user-space buffer, no write() copies. close()
+ * truncates the file to the bytes written.
+ *
+ * A Buffer for BasicPath (see MappedPath), and the storage of MappedFileSink.
+ * Move-only; POSIX only, built in qmake's unix scope.
+ */
+class MappedFile
+{
+    int         _fd;
+    char*       _data;
+    std::size_t _size;
+    std::size_t _capacity;
+    std::size_t _extent;
+
+    void grow(std::size_t size);
+
+public:
+
+    static const std::size_t DEFAULT_EXTENT = 64 * 1024 * 1024;
+
+    /**
+     * No file: appending throws until one is moved in.
+     */
+    MappedFile();
+
+    /**
+     * Creates (or truncates) `filename`. Throws std::runtime_error when it
+     * can't be opened, grown or mapped.
+     */
+    explicit MappedFile(const std::string& filename, std::size_t extent = DEFAULT_EXTENT);
+
+    MappedFile(MappedFile&& other);
+
+    MappedFile& operator=(MappedFile&& other);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Closes the file if still open, ignoring errors: call close() to see them.
+     */
+    ~MappedFile();
+
+    void append(const char* data, std::size_t size) {
+        if (this->_size + size > this->_capacity) this->grow(this->_size + size);
+        if (size > 0) std::memcpy(this->_data + this->_size, data, size);
+        this->_size += size;
+    }
+
+    const char* data() const { return this->_data; }
+
+    std::size_t size() const { return this->_size; }
+
+    std::size_t capacity() const { return this->_capacity; }
+
+    /**
+     * Starts over from the beginning of the file.
+     */
+    void clear() { this->_size = 0; }
+
+    /**
+     * Nothing to give back before close(), which truncates.
+     */
+    void shrink_to_fit() { }
+
+    bool isOpen() const { return this->_fd >= 0; }
+
+    /**
+     * Unmaps the file and truncates it to size(), leaving this empty. Throws
+     * std::runtime_error when that fails.
+     */
+    void close();
+};
+
+/**
+ * A Sink writing into a MappedFile, for encoders producing multi-gigabyte
+ * output.
+ */
+class MappedFileSink : public Sink
+{
+    MappedFile _file;
+
+public:
+
+    explicit MappedFileSink(const std::string& filename, std::size_t extent = MappedFile::DEFAULT_EXTENT)
+        : _file( filename, extent )
+    { }
+
+    void write(const char* data, std::size_t size) override { this->_file.append(data, size); }
+
+    using Sink::write;
+
+    std::size_t size() const { return this->_file.size(); }
+
+    void close() { this->_file.close(); }
+};
+
+/**
+ * A Path formatted straight into a memory-mapped file, for multi-gigabyte
+ * outputs; path.buffer().close() when done, or let it go out of scope.
+ */
+using MappedPath = BasicPath<MappedFile>;
+
+extern template class BasicPath<MappedFile>;
+
+} // namespace d3_path
+
+#endif // D3__PATH__MAPPED_FILE_HPP
@@ -0,0 +1,31 @@
+#ifndef D3__PATH__MESH_HPP
+#define D3__PATH__MESH_HPP
+
+#include <vector>
+#include <cstdint> // for std::uint32_t
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * An indexed triangle mesh, ready for a vertex and an index buffer
+ * (gl.FLOAT × 2, gl.UNSIGNED_INT). Owned by the caller: tessellation
+ * appends to it, so several paths can share one mesh, and clear() keeps
+ * the capacity for the next frame.
+ */
+struct Mesh {
+    std::vector<float>         vertices; // x, y per vertex
+    std::vector<std::uint32_t> indices;  // three per triangle
+
+    std::size_t vertexCount() const   { return this->vertices.size() / 2; }
+    std::size_t triangleCount() const { return this->indices.size() / 3; }
+
+    void clear() {
+        this->vertices.clear();
+        this->indices.clear();
+    }
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__MESH_HPP
@@ -2,19 +2,47 @@
 #define D3__PATH__PATH_HPP
 
 #include "d3_path/PathInterface.hpp"
+#include "d3_path/Arena.hpp"
+#include "d3_path/FrozenPath.hpp"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#  if __has_include(<memory_resource>)
+#    include <memory_resource>
+#    define D3_PATH_HAS_PMR 1
+#  endif
+#endif
 
 namespace d3_path {
 
-class Path : public PathInterface
+/**
+ * The SVG path serializer, over a `Buffer` holding the path data: a
+ * std::basic_string (any allocator) or a type with the same append(),
+ * data(), size(), clear(), capacity() and shrink_to_fit(). Instantiated
+ * in Path.cpp for the buffers declared `extern template`; headers of other
+ * buffers include detail/basic_path.hpp (see InlinePath.hpp).
+ */
+template <typename Buffer>
+class BasicPath final : public PathInterface
 {
     number_t _x0, _y0; // start of current subpath
     number_t _x1, _y1; // end of current subpath
+    number_t _xm, _ym; // last M written by arc() or arcTo() on an empty path, which d3 leaves out of _x0, _y0
+
+    Buffer _;
+
+    template <typename Chars>
+    void put(const Chars& chars) { this->_.append(chars.data(), chars.size()); }
 
-    std::string _;
+    void continueFrom(const BasicPath& other);
 
 public:
 
-    Path();
+    BasicPath();
+
+    /**
+     * Starts with `buffer`'s contents, and its allocator.
+     */
+    explicit BasicPath(Buffer buffer);
 
     void moveTo(number_t x, number_t y) override;
 
@@ -33,8 +61,71 @@ public:
     void rect(number_t x, number_t y, number_t w, number_t h) override;
 
     std::string toString() const override;
+
+    const Buffer& buffer() const { return this->_; }
+
+    /**
+     * For writing around the path data, e.g. an SVG header before it or a
+     * MappedFile's close() after it.
+     */
+    Buffer& buffer() { return this->_; }
+
+    /**
+     * Empties the path, keeping the buffer's capacity for the next one.
+     */
+    void clear();
+
+    /**
+     * Appends the serialized commands of `other` as they are, without
+     * formatting them again, and takes over its current point: later
+     * commands continue from where `other` ended.
+     */
+    void append(const BasicPath& other);
+
+    /**
+     * Like append(const BasicPath&), taking over `other`'s buffer instead of
+     * copying it when this path is empty. Leaves `other` cleared.
+     */
+    void append(BasicPath&& other);
+
+    /**
+     * Moves the data into an immutable, shareable snapshot, leaving this
+     * path cleared. A std::string buffer is handed over as it is; other
+     * buffers are copied once.
+     */
+    FrozenPath freeze();
+
+    std::size_t capacity() const { return this->_.capacity(); }
+
+    /**
+     * Gives back the buffer's unused capacity.
+     */
+    void shrinkToFit() { this->_.shrink_to_fit(); }
 };
 
+using Path = BasicPath<std::string>;
+
+/**
+ * A Path whose data lives in an Arena (see path(Arena&)).
+ */
+using ArenaPath = BasicPath<ArenaString>;
+
+extern template class BasicPath<std::string>;
+extern template class BasicPath<ArenaString>;
+
+#ifdef D3_PATH_HAS_PMR
+namespace pmr {
+
+/**
+ * A Path whose data comes from a std::pmr::memory_resource (see path(std::pmr::memory_resource*)).
+ */
+using Path = BasicPath<std::pmr::string>;
+
+} // namespace pmr
+
+extern template class BasicPath<std::pmr::string>;
+#endif
+
 } // namespace d3_path
 
 #endif // D3__PATH__PATH_HPP
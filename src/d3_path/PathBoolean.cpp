@@ -0,0 +1,436 @@
+#include "d3_path/PathBoolean.hpp"
+
+#include "d3_path/PathFlattener.hpp"
+#include "d3_path/detail/parallel.hpp"
+
+#include <cmath>     // for std::llround(), std::isfinite()
+#include <cstdint>   // for std::int64_t
+#include <atomic>
+#include <algorithm> // for std::sort(), std::unique(), std::min(), std::max()
+
+namespace d3_path {
+
+namespace {
+
+using number_t = PathInterface::number_t;
+using unit_t = std::int64_t;
+
+const unit_t MAX_UNITS = unit_t(1) << 30;
+
+struct IPoint {
+    unit_t x, y;
+
+    bool operator==(const IPoint& other) const { return this->x == other.x && this->y == other.y; }
+    bool operator!=(const IPoint& other) const { return !(*this == other); }
+    bool operator<(const IPoint& other) const { return this->y < other.y || (this->y == other.y && this->x < other.x); }
+};
+
+// Contour i is points[ends[i - 1] … ends[i]), implicitly closed.
+struct Polygon {
+    std::vector<IPoint>      points;
+    std::vector<std::size_t> ends;
+    FillRule                 rule;
+};
+
+struct Edge {
+    unit_t x0, y0, x1, y1; // y0 < y1
+    int    dir;            // +1 downwards in the contour, -1 upwards
+    int    operand;        // 0 or 1
+    double dxdy;
+
+    double x(double y) const { return this->x0 + (y - this->y0) * this->dxdy; }
+
+    // x at a slab boundary, snapped; exact at the end points.
+    unit_t at(unit_t y) const {
+        if (y == this->y0) return this->x0;
+        if (y == this->y1) return this->x1;
+        return std::llround(this->x0 + double(y - this->y0) * double(this->x1 - this->x0) / double(this->y1 - this->y0));
+    }
+};
+
+struct Sorted {
+    double      x;
+    std::size_t edge;
+};
+
+// A span of the result in a slab, as a signed interval on one of its borders.
+struct Interval {
+    unit_t l, r;
+};
+
+const std::size_t NO_EDGE = std::size_t(-1);
+
+struct Segment {
+    IPoint      from, to;
+    std::size_t edge; // source edge, NO_EDGE for horizontal pieces
+
+    bool operator<(const Segment& other) const {
+        return this->from < other.from || (this->from == other.from && this->to < other.to);
+    }
+};
+
+bool inside(int winding, FillRule rule)
+{
+    return (rule == FillRule::NonZero) ? (winding != 0) : (winding % 2 != 0);
+}
+
+bool apply(BooleanOp op, bool a, bool b)
+{
+    switch (op) {
+    case BooleanOp::Union:        return a || b;
+    case BooleanOp::Intersection: return a && b;
+    case BooleanOp::Difference:   return a && !b;
+    case BooleanOp::Xor:          return a != b;
+    }
+    return false;
+}
+
+bool collinear(const IPoint& a, const IPoint& b, const IPoint& c)
+{
+    // |coordinates| ≤ 2^30: both products fit in 62 bits.
+    return (b.x - a.x) * (c.y - b.y) == (b.y - a.y) * (c.x - b.x);
+}
+
+unit_t snap(number_t v, number_t grid)
+{
+    if (!std::isfinite(v)) return 0;
+    const number_t u = v / grid;
+    if (u > MAX_UNITS)  return MAX_UNITS;
+    if (u < -MAX_UNITS) return -MAX_UNITS;
+    return std::llround(u);
+}
+
+Polygon flatten(const RecordedPath& path, const BooleanOptions& options)
+{
+    PathFlattener flattener(options.tolerance);
+    path.replay(flattener);
+
+    Polygon polygon;
+    polygon.rule = options.rule;
+
+    const std::vector<PathFlattener::Point>& points = flattener.points();
+    for (const PathFlattener::Contour& contour : flattener.contours()) {
+        const std::size_t begin = polygon.points.size();
+        for (std::size_t i = contour.begin; i < contour.end; ++i) {
+            const IPoint p = { snap(points[i].x, options.grid), snap(points[i].y, options.grid) };
+            if (polygon.points.size() == begin || polygon.points.back() != p) polygon.points.push_back(p);
+        }
+        if (polygon.points.size() - begin < 3) polygon.points.resize(begin);
+        else polygon.ends.push_back(polygon.points.size());
+    }
+    return polygon;
+}
+
+void addEdges(const Polygon& polygon, int operand, std::vector<Edge>& edges)
+{
+    std::size_t begin = 0;
+    for (const std::size_t end : polygon.ends) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const IPoint
+                    a = polygon.points[i],
+                    b = polygon.points[(i + 1 < end) ? i + 1 : begin];
+            if (a.y == b.y) continue;
+
+            Edge edge = (a.y < b.y) ? Edge{ a.x, a.y, b.x, b.y, 1, operand, 0 } : Edge{ b.x, b.y, a.x, a.y, -1, operand, 0 };
+            edge.dxdy = double(edge.x1 - edge.x0) / double(edge.y1 - edge.y0);
+            edges.push_back(edge);
+        }
+        begin = end;
+    }
+}
+
+// Horizontal boundary pieces along y: intervals from the slab below count +1
+// (left to right), from the slab above -1, the net count gives the pieces.
+void addHorizontal(unit_t y, const std::vector<Interval>& below, const std::vector<Interval>& above,
+                   std::vector<std::pair<unit_t, int>>& events, std::vector<Segment>& segments)
+{
+    events.clear();
+    const auto add = [&events](const Interval& interval, int sign) {
+        if (interval.l < interval.r) {
+            events.emplace_back(interval.l, sign);
+            events.emplace_back(interval.r, -sign);
+        }
+        else if (interval.l > interval.r) {
+            events.emplace_back(interval.r, -sign);
+            events.emplace_back(interval.l, sign);
+        }
+    };
+    for (const Interval& interval : below) add(interval, 1);
+    for (const Interval& interval : above) add(interval, -1);
+    if (events.empty()) return;
+
+    std::sort(events.begin(), events.end());
+
+    int count = 0;
+    for (std::size_t i = 0; i + 1 < events.size(); ++i) {
+        count += events[i].second;
+        const unit_t x0 = events[i].first, x1 = events[i + 1].first;
+        if (x0 == x1) continue;
+        for (int k = 0; k < count; ++k)  segments.push_back( Segment{ IPoint{x0, y}, IPoint{x1, y}, NO_EDGE } );
+        for (int k = 0; k < -count; ++k) segments.push_back( Segment{ IPoint{x1, y}, IPoint{x0, y}, NO_EDGE } );
+    }
+}
+
+// Chains the boundary segments into contours, dropping collinear points.
+Polygon link(std::vector<Segment>& segments)
+{
+    Polygon polygon;
+    polygon.rule = FillRule::NonZero;
+
+    std::sort(segments.begin(), segments.end());
+    std::vector<bool> used(segments.size(), false);
+    std::vector<std::size_t> contour;
+
+    for (std::size_t s = 0; s < segments.size(); ++s) {
+        if (used[s]) continue;
+
+        contour.clear();
+        const IPoint start = segments[s].from;
+        std::size_t current = s;
+        for (;;) {
+            used[current] = true;
+            contour.push_back(current);
+
+            const IPoint p = segments[current].to;
+            if (p == start) break;
+
+            // Next unused segment leaving p.
+            auto it = std::lower_bound(segments.begin(), segments.end(), Segment{ p, IPoint{ -MAX_UNITS - 1, -MAX_UNITS - 1 }, NO_EDGE });
+            std::size_t next = static_cast<std::size_t>(it - segments.begin());
+            while (next < segments.size() && segments[next].from == p && used[next]) ++next;
+            if (next == segments.size() || segments[next].from != p) break; // unbalanced, by rounding
+            current = next;
+        }
+
+        // Drop the points between pieces of the same source edge (only nearly
+        // collinear once snapped), then repeated and collinear points, around
+        // the closing point too.
+        const std::size_t begin = polygon.points.size();
+        for (std::size_t i = 0; i < contour.size(); ++i) {
+            const Segment& segment = segments[contour[i]];
+            const std::size_t previous = contour[(i > 0) ? i - 1 : contour.size() - 1];
+            if (segment.edge != NO_EDGE && segment.edge == segments[previous].edge && contour.size() > 3) continue;
+
+            const IPoint p = segment.from;
+            std::vector<IPoint>& out = polygon.points;
+            if (out.size() > begin && out.back() == p) continue;
+            while (out.size() - begin >= 2 && collinear(out[out.size() - 2], out.back(), p)) out.pop_back();
+            out.push_back(p);
+        }
+        std::size_t first = begin;
+        for (bool changed = true; changed && polygon.points.size() - first >= 3;) {
+            std::vector<IPoint>& out = polygon.points;
+            changed = false;
+            if (collinear(out[out.size() - 2], out.back(), out[first])) {
+                out.pop_back();
+                changed = true;
+            }
+            else if (collinear(out.back(), out[first], out[first + 1])) {
+                ++first;
+                changed = true;
+            }
+        }
+        if (polygon.points.size() - first < 3) {
+            polygon.points.resize(begin);
+            continue;
+        }
+        polygon.points.erase(polygon.points.begin() + begin, polygon.points.begin() + first);
+        polygon.ends.push_back(polygon.points.size());
+    }
+    return polygon;
+}
+
+Polygon combine(const Polygon& a, const Polygon& b, BooleanOp op)
+{
+    std::vector<Edge> edges;
+    addEdges(a, 0, edges);
+    addEdges(b, 1, edges);
+
+    std::vector<Segment> segments;
+    if (edges.empty()) return link(segments);
+
+    std::vector<std::size_t> byTop(edges.size());
+    for (std::size_t i = 0; i < edges.size(); ++i) byTop[i] = i;
+    std::sort(byTop.begin(), byTop.end(), [&edges](std::size_t i, std::size_t j) {
+        return edges[i].y0 < edges[j].y0 || (edges[i].y0 == edges[j].y0 && i < j);
+    });
+
+    // Slab boundaries: every end point, and every crossing snapped to the grid.
+    std::vector<unit_t> ys;
+    ys.reserve(2 * edges.size());
+    for (const Edge& edge : edges) {
+        ys.push_back(edge.y0);
+        ys.push_back(edge.y1);
+    }
+
+    std::vector<Sorted> active;
+    for (const std::size_t i : byTop) {
+        const Edge& e = edges[i];
+
+        std::size_t kept = 0;
+        for (const Sorted& s : active) {
+            const Edge& o = edges[s.edge];
+            if (o.y1 <= e.y0) continue;
+            active[kept++] = s;
+
+            const double
+                    top = double(e.y0),
+                    bottom = double(std::min(o.y1, e.y1)),
+                    dTop = o.x(top) - e.x(top),
+                    dBottom = o.x(bottom) - e.x(bottom);
+            if ((dTop < 0 && dBottom > 0) || (dTop > 0 && dBottom < 0)) {
+                const unit_t y = std::llround(top + (bottom - top) * (dTop / (dTop - dBottom)));
+                if (y > e.y0 && y < std::min(o.y1, e.y1)) ys.push_back(y);
+            }
+        }
+        active.resize(kept);
+        active.push_back( Sorted{0, i} );
+    }
+
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    // Sweep the slabs: where the result changes across a group of coincident
+    // edges, that part of the group is boundary, inside on its right.
+    std::vector<Interval> tops, bottoms, previous;
+    std::vector<std::pair<unit_t, int>> events;
+    unit_t previousY = 0;
+
+    active.clear();
+    std::size_t next = 0;
+    for (std::size_t k = 0; k + 1 < ys.size(); ++k) {
+        const unit_t top = ys[k], bottom = ys[k + 1];
+        const double middle = (double(top) + double(bottom)) / 2;
+
+        std::size_t kept = 0;
+        for (const Sorted& s : active) {
+            if (edges[s.edge].y1 > top) active[kept++] = s;
+        }
+        active.resize(kept);
+        for (; next < byTop.size() && edges[byTop[next]].y0 <= top; ++next) {
+            active.push_back( Sorted{0, byTop[next]} );
+        }
+
+        for (Sorted& s : active) s.x = edges[s.edge].x(middle);
+        for (std::size_t i = 1; i < active.size(); ++i) {
+            const Sorted s = active[i];
+            std::size_t j = i;
+            for (; j > 0 && (active[j - 1].x > s.x || (active[j - 1].x == s.x && active[j - 1].edge > s.edge)); --j) {
+                active[j] = active[j - 1];
+            }
+            active[j] = s;
+        }
+
+        tops.clear();
+        bottoms.clear();
+        int winding[2] = { 0, 0 };
+        bool in = false;
+        unit_t openTop = 0, openBottom = 0;
+
+        for (std::size_t i = 0; i < active.size();) {
+            const std::size_t group = i;
+            const Edge& first = edges[active[i].edge];
+            const unit_t xTop = first.at(top), xBottom = first.at(bottom);
+
+            for (; i < active.size(); ++i) {
+                const Edge& e = edges[active[i].edge];
+                if (e.at(top) != xTop || e.at(bottom) != xBottom) break;
+                winding[e.operand] += e.dir;
+            }
+
+            const bool now = apply(op, inside(winding[0], a.rule), inside(winding[1], b.rule));
+            if (now == in) continue;
+
+            if (now) {
+                segments.push_back( Segment{ IPoint{xBottom, bottom}, IPoint{xTop, top}, active[group].edge } );
+                openTop = xTop;
+                openBottom = xBottom;
+            }
+            else {
+                segments.push_back( Segment{ IPoint{xTop, top}, IPoint{xBottom, bottom}, active[group].edge } );
+                tops.push_back( Interval{openTop, xTop} );
+                bottoms.push_back( Interval{openBottom, xBottom} );
+            }
+            in = now;
+        }
+
+        if (previousY != top) {
+            addHorizontal(previousY, {}, previous, events, segments);
+            previous.clear();
+        }
+        addHorizontal(top, tops, previous, events, segments);
+
+        std::swap(previous, bottoms);
+        previousY = bottom;
+    }
+    addHorizontal(previousY, {}, previous, events, segments);
+
+    return link(segments);
+}
+
+void write(const Polygon& polygon, number_t grid, PathInterface& out)
+{
+    std::size_t begin = 0;
+    for (const std::size_t end : polygon.ends) {
+        out.moveTo(polygon.points[begin].x * grid, polygon.points[begin].y * grid);
+        for (std::size_t i = begin + 1; i < end; ++i) out.lineTo(polygon.points[i].x * grid, polygon.points[i].y * grid);
+        out.closePath();
+        begin = end;
+    }
+}
+
+// Combines polygons pairwise, one tree level at a time, the pairs of a level in parallel.
+Polygon reduce(std::vector<Polygon> level, BooleanOp op, unsigned threads)
+{
+    while (level.size() > 1) {
+        const std::size_t pairs = level.size() / 2;
+        std::vector<Polygon> up((level.size() + 1) / 2);
+        if (level.size() % 2 != 0) up.back() = std::move(level.back());
+
+        std::atomic<std::size_t> counter( 0 );
+        detail::parallelFor(static_cast<unsigned>( std::min<std::size_t>(threads, pairs) ), [&](unsigned) {
+            for (std::size_t i = counter++; i < pairs; i = counter++) {
+                up[i] = combine(level[2 * i], level[2 * i + 1], op);
+            }
+        });
+        level.swap(up);
+    }
+    return std::move(level.front());
+}
+
+} // namespace
+
+void booleanOp(const RecordedPath& a, const RecordedPath& b, BooleanOp op, PathInterface& out, const BooleanOptions& options)
+{
+    write(combine(flatten(a, options), flatten(b, options), op), options.grid, out);
+}
+
+void booleanOp(const std::vector<RecordedPath>& paths, BooleanOp op, PathInterface& out, const BooleanOptions& options)
+{
+    if (paths.empty()) return;
+
+    const unsigned threads = detail::resolveThreads(options.threads);
+
+    std::vector<Polygon> leaves(paths.size());
+    std::atomic<std::size_t> counter( 0 );
+    detail::parallelFor(static_cast<unsigned>( std::min<std::size_t>(threads, paths.size()) ), [&](unsigned) {
+        for (std::size_t i = counter++; i < paths.size(); i = counter++) leaves[i] = flatten(paths[i], options);
+    });
+
+    Polygon result;
+    if (leaves.size() == 1) {
+        result = combine(leaves.front(), Polygon{ {}, {}, FillRule::NonZero }, BooleanOp::Union);
+    }
+    else if (op == BooleanOp::Difference) {
+        const Polygon first = std::move(leaves.front());
+        leaves.erase(leaves.begin());
+        const Polygon others = (leaves.size() == 1) ? std::move(leaves.front()) : reduce(std::move(leaves), BooleanOp::Union, threads);
+        result = combine(first, others, BooleanOp::Difference);
+    }
+    else {
+        result = reduce(std::move(leaves), op, threads);
+    }
+    write(result, options.grid, out);
+}
+
+} // namespace d3_path
@@ -0,0 +1,78 @@
+#ifndef D3__PATH__PATH_BOOLEAN_HPP
+#define D3__PATH__PATH_BOOLEAN_HPP
+
+#include "d3_path/RecordedPath.hpp"
+#include "d3_path/FillRule.hpp"
+
+#include <vector>
+
+namespace d3_path {
+
+enum class BooleanOp {
+    Union,
+    Intersection,
+    Difference, // the first operand minus all the others
+    Xor,
+};
+
+struct BooleanOptions
+{
+    using number_t = PathInterface::number_t;
+
+    /**
+     * Flattening tolerance of curves and arcs.
+     */
+    number_t tolerance;
+
+    /**
+     * Grid every vertex and crossing is snapped to; coordinates must stay
+     * within ±2^30 grid units.
+     */
+    number_t grid;
+
+    /**
+     * Fill rule of the input paths.
+     */
+    FillRule rule;
+
+    /**
+     * Number of worker threads for operations over many paths; 0 means one per core.
+     */
+    unsigned threads;
+
+    BooleanOptions()
+        : tolerance( 0.25 )
+        , grid( 1.0 / 256 )
+        , rule( FillRule::NonZero )
+        , threads( 0 )
+    { }
+};
+
+/**
+ * Combines the fills of `a` and `b` and writes the outline of the result
+ * to `out`, as closed polygons: outer contours clockwise on screen, holes
+ * counterclockwise, no self-intersections, straight runs merged. It fills
+ * the same with either fill rule.
+ *
+ * Curves and arcs are flattened first. A sweep-line cuts the plane into
+ * slabs at every vertex and crossing, with coordinates snapped to
+ * `options.grid`; within a slab, the winding numbers of both operands
+ * give the spans of the result, and the result's boundary is where
+ * inside and outside meet. Shared edges (e.g. between adjacent map cells)
+ * cancel out exactly.
+ */
+void booleanOp(const RecordedPath& a, const RecordedPath& b, BooleanOp op, PathInterface& out,
+               const BooleanOptions& options = BooleanOptions());
+
+/**
+ * Combines the fills of all `paths`: pairwise, in a balanced tree whose
+ * levels run on `options.threads` threads. A single path is cleaned up
+ * (overlaps resolved by the fill rule). For Difference, the first path
+ * minus the union of the others.
+ */
+void booleanOp(const std::vector<RecordedPath>& paths, BooleanOp op, PathInterface& out,
+               const BooleanOptions& options = BooleanOptions());
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_BOOLEAN_HPP
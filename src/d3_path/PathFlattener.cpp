@@ -0,0 +1,151 @@
+#include "d3_path/PathFlattener.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/detail/constants.hpp"
+
+#include <cmath>     // for std::abs(), std::sqrt(), std::ceil(), std::acos(), std::cos(), std::sin()
+#include <algorithm> // for std::max(), std::min()
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+using detail::pi;
+
+namespace {
+
+// Upper bound on the subdivision of a single segment, against huge or non-finite input.
+const int MAX_SEGMENTS = 1 << 16;
+
+int clampSegments(PathInterface::number_t n)
+{
+    if (!(n > 1)) return 1;
+    if (n > MAX_SEGMENTS) return MAX_SEGMENTS;
+    return static_cast<int>( std::ceil(n) );
+}
+
+} // namespace
+
+PathFlattener::PathFlattener(PathInterface::number_t tolerance)
+    : _tolerance( tolerance )
+{ }
+
+void PathFlattener::addPoint(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_points.push_back( Point{x, y} );
+    this->_contours.back().end = this->_points.size();
+}
+
+void PathFlattener::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    // A contour holding only its start point is reused, so repeated moveTo don't pile up.
+    if ( !this->_contours.empty() && this->_contours.back().size() == 1 ) {
+        this->_points.back() = Point{x, y};
+        this->_contours.back().closed = false;
+        return;
+    }
+
+    this->_contours.push_back( Contour{this->_points.size(), this->_points.size(), false} );
+    this->addPoint(x, y);
+}
+
+void PathFlattener::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->addPoint(x, y);
+}
+
+void PathFlattener::emitQuadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    const number_t
+            x0 = this->_x1,
+            y0 = this->_y1,
+            ddx = x0 - 2 * x1 + x,
+            ddy = y0 - 2 * y1 + y;
+
+    // Wang's formula: n ≥ √(|P0 - 2·P1 + P2| / (4·tolerance)).
+    const int n = clampSegments( std::sqrt(std::sqrt(ddx * ddx + ddy * ddy) / (4 * this->_tolerance)) );
+
+    for (int i = 1; i < n; ++i) {
+        const number_t t = number_t(i) / n, mt = 1 - t;
+        this->addPoint(mt * mt * x0 + 2 * mt * t * x1 + t * t * x,
+                       mt * mt * y0 + 2 * mt * t * y1 + t * t * y);
+    }
+    this->addPoint(x, y);
+}
+
+void PathFlattener::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    const number_t
+            x0 = this->_x1,
+            y0 = this->_y1,
+            ddx0 = x0 - 2 * x1 + x2,
+            ddy0 = y0 - 2 * y1 + y2,
+            ddx1 = x1 - 2 * x2 + x,
+            ddy1 = y1 - 2 * y2 + y,
+            dd = std::sqrt( std::max(ddx0 * ddx0 + ddy0 * ddy0, ddx1 * ddx1 + ddy1 * ddy1) );
+
+    // Wang's formula: n ≥ √(3·max|Pi - 2·Pi+1 + Pi+2| / (4·tolerance)).
+    const int n = clampSegments( std::sqrt(3 * dd / (4 * this->_tolerance)) );
+
+    for (int i = 1; i < n; ++i) {
+        const number_t
+                t = number_t(i) / n,
+                mt = 1 - t,
+                a = mt * mt * mt,
+                b = 3 * mt * mt * t,
+                c = 3 * mt * t * t,
+                d = t * t * t;
+        this->addPoint(a * x0 + b * x1 + c * x2 + d * x,
+                       a * y0 + b * y1 + c * y2 + d * y);
+    }
+    this->addPoint(x, y);
+}
+
+void PathFlattener::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    // A chord spanning θ deviates from the circle by r·(1 - cos(θ/2)).
+    const number_t
+            c = 1 - this->_tolerance / r,
+            theta = (c > -1) ? 2 * std::acos(c) : pi;
+
+    const int n = clampSegments( std::abs(da) / theta );
+    const number_t step = da / n;
+
+    for (int i = 1; i <= n; ++i) {
+        const number_t a = a0 + i * step;
+        this->addPoint(cx + r * std::cos(a), cy + r * std::sin(a));
+    }
+}
+
+void PathFlattener::emitClosePath()
+{
+    Contour& contour = this->_contours.back();
+    contour.closed = true;
+
+    // Drawing continues from the subpath start, in a new contour.
+    const Point start = this->_points[contour.begin];
+    this->_contours.push_back( Contour{this->_points.size(), this->_points.size(), false} );
+    this->addPoint(start.x, start.y);
+}
+
+void PathFlattener::clear()
+{
+    this->_points.clear();
+    this->_contours.clear();
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+std::string PathFlattener::toString() const
+{
+    Path path;
+    for (const Contour& contour : this->_contours) {
+        if (contour.size() < 2) continue;
+
+        const Point* p = this->_points.data() + contour.begin;
+        path.moveTo(p[0].x, p[0].y);
+        for (std::size_t i = 1; i < contour.size(); ++i) path.lineTo(p[i].x, p[i].y);
+        if (contour.closed) path.closePath();
+    }
+    return path.toString();
+}
+
+} // namespace d3_path
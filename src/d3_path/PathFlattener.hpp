@@ -0,0 +1,80 @@
+#ifndef D3__PATH__PATH_FLATTENER_HPP
+#define D3__PATH__PATH_FLATTENER_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * A PathInterface that flattens everything it receives into polylines:
+ * curves and arcs are subdivided so that no point of the polyline is
+ * farther than `tolerance` from the exact curve.
+ *
+ * The result is a list of contours, each a range of points(); a contour
+ * is marked closed when it ended with closePath. Fill-oriented consumers
+ * (rasterizer, tessellator, boolean operations) treat every contour as closed.
+ */
+class PathFlattener : public PathNormalizer
+{
+public:
+
+    struct Point {
+        number_t x, y;
+    };
+
+    struct Contour {
+        std::size_t begin, end; // range of points()
+        bool        closed;
+
+        std::size_t size() const { return this->end - this->begin; }
+    };
+
+protected:
+
+    number_t _tolerance;
+
+    std::vector<Point>   _points;
+    std::vector<Contour> _contours;
+
+    void addPoint(number_t x, number_t y);
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitQuadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+public:
+
+    PathFlattener(number_t tolerance = 0.25);
+
+    number_t tolerance() const { return this->_tolerance; }
+
+    void setTolerance(number_t tolerance) { this->_tolerance = tolerance; }
+
+    const std::vector<Point>&   points() const   { return this->_points; }
+    const std::vector<Contour>& contours() const { return this->_contours; }
+
+    /**
+     * Forgets the geometry (and the current point), keeping the allocated capacity.
+     */
+    void clear();
+
+    /**
+     * Returns the flattened geometry as "M…L…Z" path data.
+     */
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_FLATTENER_HPP
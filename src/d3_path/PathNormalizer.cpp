@@ -0,0 +1,232 @@
+#include "d3_path/PathNormalizer.hpp"
+
+#include "d3_path/detail/constants.hpp"
+#include "d3_path/detail/to_str.hpp"
+
+#include <cmath>     // for std::isnan(), std::abs(), std::sqrt(), std::tan(), std::acos(), std::atan2(), std::cos(), std::sin(), std::fmod(), std::ceil()
+#include <stdexcept> // for std::runtime_error()
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+using detail::pi;
+using detail::tau;
+using detail::epsilon;
+using detail::tauEpsilon;
+
+PathNormalizer::PathNormalizer()
+    : _x0( NULL_NUMBER )
+    , _y0( NULL_NUMBER )
+    , _x1( NULL_NUMBER )
+    , _y1( NULL_NUMBER )
+{ }
+
+void PathNormalizer::emitQuadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    const number_t
+            x0 = this->_x1,
+            y0 = this->_y1;
+
+    this->emitBezierCurveTo(x0 + 2 * (x1 - x0) / 3, y0 + 2 * (y1 - y0) / 3,
+                            x  + 2 * (x1 - x ) / 3, y  + 2 * (y1 - y ) / 3,
+                            x, y);
+}
+
+void PathNormalizer::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    // At most a quarter turn per cubic keeps the radial error below 0.03%.
+    int n = static_cast<int>( std::ceil(std::abs(da) / (pi / 2) - epsilon) );
+    if (n < 1) n = 1;
+
+    const number_t
+            step = da / n,
+            k = 4 * std::tan(step / 4) / 3;
+
+    number_t
+            c0 = std::cos(a0),
+            s0 = std::sin(a0);
+
+    for (int i = 1; i <= n; ++i) {
+        const number_t
+                a1 = a0 + i * step,
+                c1 = std::cos(a1),
+                s1 = std::sin(a1);
+
+        this->emitBezierCurveTo(cx + r * (c0 - k * s0), cy + r * (s0 + k * c0),
+                                cx + r * (c1 + k * s1), cy + r * (s1 - k * c1),
+                                cx + r * c1,            cy + r * s1);
+        c0 = c1;
+        s0 = s1;
+    }
+}
+
+void PathNormalizer::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->moveTo(x, y);
+    this->lineTo(x + w, y);
+    this->lineTo(x + w, y + h);
+    this->lineTo(x, y + h);
+    this->closePath();
+}
+
+void PathNormalizer::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->emitMoveTo(x, y);
+    this->_x0 = this->_x1 = x;
+    this->_y0 = this->_y1 = y;
+}
+
+void PathNormalizer::closePath()
+{
+    if ( std::isnan( this->_x1 ) == false ) {
+        this->emitClosePath();
+        this->_x1 = this->_x0; this->_y1 = this->_y0;
+    }
+}
+
+void PathNormalizer::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    if ( std::isnan( this->_x1 ) == true ) {
+        this->moveTo(x, y);
+        return;
+    }
+
+    this->emitLineTo(x, y);
+    this->_x1 = x; this->_y1 = y;
+}
+
+void PathNormalizer::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    if ( std::isnan( this->_x1 ) == true ) this->moveTo(x1, y1);
+
+    this->emitQuadraticCurveTo(x1, y1, x, y);
+    this->_x1 = x; this->_y1 = y;
+}
+
+void PathNormalizer::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    if ( std::isnan( this->_x1 ) == true ) this->moveTo(x1, y1);
+
+    this->emitBezierCurveTo(x1, y1, x2, y2, x, y);
+    this->_x1 = x; this->_y1 = y;
+}
+
+void PathNormalizer::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    const number_t
+            x0 = this->_x1,
+            y0 = this->_y1,
+            x21 = x2 - x1,
+            y21 = y2 - y1,
+            x01 = x0 - x1,
+            y01 = y0 - y1,
+            l01_2 = x01 * x01 + y01 * y01;
+
+    // Is the radius negative? Error.
+    if (r < 0) throw std::runtime_error("negative radius: " + detail::to_str(r));
+
+    // Is this path empty? Move to (x1,y1).
+    if ( std::isnan( this->_x1 ) == true ) {
+        this->moveTo(x1, y1);
+    }
+
+    // Or, is (x1,y1) coincident with (x0,y0)? Do nothing.
+    else if (!(l01_2 > epsilon));
+
+    // Or, are (x0,y0), (x1,y1) and (x2,y2) collinear?
+    // Equivalently, is (x1,y1) coincident with (x2,y2)?
+    // Or, is the radius zero? Line to (x1,y1).
+    else if (!(std::abs(y01 * x21 - y21 * x01) > epsilon) || !r) {
+        this->lineTo(x1, y1);
+    }
+
+    // Otherwise, draw an arc!
+    else {
+        const number_t
+                x20 = x2 - x0,
+                y20 = y2 - y0,
+                l21_2 = x21 * x21 + y21 * y21,
+                l20_2 = x20 * x20 + y20 * y20,
+                l21 = std::sqrt(l21_2),
+                l01 = std::sqrt(l01_2),
+                da = pi - std::acos((l21_2 + l01_2 - l20_2) / (2 * l21 * l01)),
+                l = r * std::tan(da / 2),
+                t01 = l / l01,
+                t21 = l / l21;
+
+        // If the start tangent is not coincident with (x0,y0), line to.
+        if (std::abs(t01 - 1) > epsilon) {
+            this->lineTo(x1 + t01 * x01, y1 + t01 * y01);
+        }
+
+        // The center lies on the bisector of the corner, at distance √(l² + r²) from (x1,y1).
+        const number_t
+                bx = x01 / l01 + x21 / l21,
+                by = y01 / l01 + y21 / l21,
+                bl = std::sqrt(bx * bx + by * by),
+                d = std::sqrt(l * l + r * r),
+                cx = x1 + bx / bl * d,
+                cy = y1 + by / bl * d,
+                a0 = std::atan2(y1 + t01 * y01 - cy, x1 + t01 * x01 - cx),
+                cw = (y01 * x20 > x01 * y20);
+
+        this->emitArc(cx, cy, r, a0, cw ? da : -da);
+        this->_x1 = x1 + t21 * x21;
+        this->_y1 = y1 + t21 * y21;
+    }
+}
+
+void PathNormalizer::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    const number_t
+            dx = r * std::cos(a0),
+            dy = r * std::sin(a0),
+            x0 = x + dx,
+            y0 = y + dy;
+    const bool
+            cw = !ccw;
+    number_t
+            da = ccw ? a0 - a1 : a1 - a0;
+
+    // Is the radius negative? Error.
+    if (r < 0) throw std::runtime_error("negative radius: " + detail::to_str(r));
+
+    // Is this path empty? Move to (x0,y0).
+    if ( std::isnan( this->_x1 ) == true ) {
+        this->moveTo(x0, y0);
+    }
+
+    // Or, is (x0,y0) not coincident with the previous point? Line to (x0,y0).
+    else if ( std::abs(this->_x1 - x0) > epsilon || std::abs(this->_y1 - y0) > epsilon) {
+        this->lineTo(x0, y0);
+    }
+
+    // Is this arc empty? We’re done.
+    if (!r) return;
+
+    // Does the angle go the wrong way? Flip the direction.
+    if (da < 0) da = std::fmod(da , tau) + tau;
+
+    // Is this a complete circle? Draw a full turn, back to (x0,y0).
+    if (da > tauEpsilon) {
+        this->emitArc(x, y, r, a0, cw ? tau : -tau);
+        this->_x1 = x0;
+        this->_y1 = y0;
+    }
+
+    // Is this arc non-empty? Draw an arc!
+    else if (da > epsilon) {
+        this->emitArc(x, y, r, a0, cw ? da : -da);
+        this->_x1 = x + r * std::cos(a1);
+        this->_y1 = y + r * std::sin(a1);
+    }
+}
+
+void PathNormalizer::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->emitRect(x, y, w, h);
+    this->_x0 = this->_x1 = x;
+    this->_y0 = this->_y1 = y;
+}
+
+} // namespace d3_path
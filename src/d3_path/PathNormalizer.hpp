@@ -0,0 +1,77 @@
+#ifndef D3__PATH__PATH_NORMALIZER_HPP
+#define D3__PATH__PATH_NORMALIZER_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+namespace d3_path {
+
+/**
+ * Base class for PathInterface implementations that are not SVG strings
+ * (transforms, rasterizers, other graphics APIs).
+ *
+ * It resolves d3's arcTo / arc / rect rules - including the epsilon tests
+ * of Path.cpp - and tracks the current point, then hands the result to a
+ * small set of protected emit* hooks. Derived classes implement the hooks;
+ * the optional ones have defaults built on the required ones (quadratic and
+ * arc segments become cubic Béziers, rect becomes a closed polyline).
+ * While a hook runs, (_x1, _y1) still holds the start point of the segment.
+ *
+ * Unlike Path, which emits "L" or "Q" without a preceding "M", drawing on
+ * an empty path first emits a moveTo to the segment start, as canvas does.
+ */
+class PathNormalizer : public PathInterface
+{
+protected:
+
+    number_t _x0, _y0; // start of current subpath
+    number_t _x1, _y1; // end of current subpath
+
+    virtual void emitMoveTo(number_t x, number_t y) = 0;
+
+    virtual void emitLineTo(number_t x, number_t y) = 0;
+
+    /**
+     * Quadratic segment from the current point (_x1, _y1). Defaults to the equivalent cubic.
+     */
+    virtual void emitQuadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y);
+
+    virtual void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) = 0;
+
+    /**
+     * Circular arc around ⟨cx, cy⟩ starting at angle a0 (the current point) and sweeping by `da`:
+     * positive sweeps go clockwise on screen (increasing angles, SVG sweep-flag 1), |da| ≤ τ.
+     * Defaults to cubic Béziers of at most a quarter turn each.
+     */
+    virtual void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da);
+
+    virtual void emitClosePath() = 0;
+
+    /**
+     * Closed axis-aligned rectangle subpath. Defaults to moveTo + 3 × lineTo + closePath.
+     */
+    virtual void emitRect(number_t x, number_t y, number_t w, number_t h);
+
+public:
+
+    PathNormalizer();
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t r) override;
+
+    void arc(number_t x, number_t y, number_t r, number_t a0, number_t a1, bool ccw = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_NORMALIZER_HPP
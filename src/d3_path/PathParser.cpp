@@ -0,0 +1,320 @@
+#include "d3_path/PathParser.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+#include <cmath>     // for std::abs(), std::sqrt(), std::atan2(), std::cos(), std::sin(), std::tan(), std::ceil(), std::fmod()
+#include <cstdlib>   // for std::strtod()
+#include <clocale>   // for std::localeconv()
+#include <string>
+#include <stdexcept> // for std::runtime_error()
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#  if __has_include(<charconv>)
+#    include <charconv> // for std::from_chars()
+#  endif
+#endif
+
+namespace d3_path {
+
+using detail::pi;
+using detail::tau;
+using detail::epsilon;
+
+namespace {
+
+using number_t = PathInterface::number_t;
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Converts a scanned SVG number, `point` being its '.' (or nullptr).
+number_t toNumber(const char* begin, const char* end, const char* point)
+{
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    (void)point;
+    if (*begin == '+') ++begin;
+    number_t value = 0;
+    std::from_chars(begin, end, value);
+    return value;
+#else
+    // strtod() wants the C locale's decimal point.
+    std::string chars(begin, end);
+    if (point != nullptr) chars.replace(point - begin, 1, std::localeconv()->decimal_point);
+    return std::strtod(chars.c_str(), nullptr);
+#endif
+}
+
+class Parser
+{
+    const char* _p;
+    const char* _end;
+
+    void skipSeparators() {
+        while (this->_p < this->_end && (*this->_p == ' ' || *this->_p == ',' || *this->_p == '\t'
+                                      || *this->_p == '\n' || *this->_p == '\r' || *this->_p == '\f')) {
+            ++this->_p;
+        }
+    }
+
+public:
+
+    Parser(const std::string& data)
+        : _p( data.data() )
+        , _end( data.data() + data.size() )
+    { }
+
+    bool atEnd() {
+        this->skipSeparators();
+        return this->_p == this->_end;
+    }
+
+    // Next command letter, or 0 when a number follows instead.
+    char command() {
+        this->skipSeparators();
+        const char c = *this->_p;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            ++this->_p;
+            return c;
+        }
+        return 0;
+    }
+
+    // An SVG number: sign, digits with an optional '.', optional exponent.
+    // No inf, nan or hex floats; '.' whatever the C locale (setlocale()) says.
+    number_t number() {
+        this->skipSeparators();
+        const char* const begin = this->_p;
+        const char* p = begin;
+        const char* point = nullptr;
+
+        if (p < this->_end && (*p == '+' || *p == '-')) ++p;
+        const char* const digits = p;
+        while (p < this->_end && isDigit(*p)) ++p;
+        if (p < this->_end && *p == '.') {
+            point = p++;
+            while (p < this->_end && isDigit(*p)) ++p;
+        }
+        if (p - digits == (point ? 1 : 0)) throw std::runtime_error("invalid path data: number expected");
+
+        if (p < this->_end && (*p == 'e' || *p == 'E')) {
+            const char* e = p + 1;
+            if (e < this->_end && (*e == '+' || *e == '-')) ++e;
+            if (e < this->_end && isDigit(*e)) {
+                while (e < this->_end && isDigit(*e)) ++e;
+                p = e;
+            }
+        }
+        this->_p = p;
+
+        return toNumber(begin, p, point);
+    }
+
+    bool flag() {
+        this->skipSeparators();
+        if (this->_p == this->_end || (*this->_p != '0' && *this->_p != '1')) {
+            throw std::runtime_error("invalid path data: flag expected");
+        }
+        return *this->_p++ == '1';
+    }
+};
+
+// SVG elliptical arc from ⟨x0, y0⟩ to ⟨x, y⟩ (implementation notes F.6.5 / F.6.6).
+void ellipticalArc(PathInterface& out,
+                   number_t x0, number_t y0, number_t rx, number_t ry, number_t angle,
+                   bool largeArc, bool sweep, number_t x, number_t y)
+{
+    if (x == x0 && y == y0) return;
+
+    rx = std::abs(rx);
+    ry = std::abs(ry);
+    if (!(rx > 0) || !(ry > 0)) {
+        out.lineTo(x, y);
+        return;
+    }
+
+    const number_t
+            phi = std::fmod(angle, 360) * pi / 180,
+            cosPhi = std::cos(phi),
+            sinPhi = std::sin(phi),
+            dx2 = (x0 - x) / 2,
+            dy2 = (y0 - y) / 2,
+            x1p =  cosPhi * dx2 + sinPhi * dy2,
+            y1p = -sinPhi * dx2 + cosPhi * dy2;
+
+    // Scale radii up when the endpoints can't be reached.
+    const number_t lambda = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry);
+    if (lambda > 1) {
+        rx *= std::sqrt(lambda);
+        ry *= std::sqrt(lambda);
+    }
+
+    const number_t
+            rx2 = rx * rx,
+            ry2 = ry * ry,
+            num = rx2 * ry2 - rx2 * y1p * y1p - ry2 * x1p * x1p,
+            den = rx2 * y1p * y1p + ry2 * x1p * x1p,
+            k = ((largeArc == sweep) ? -1 : 1) * std::sqrt(num > 0 ? num / den : 0),
+            cxp =  k * rx * y1p / ry,
+            cyp = -k * ry * x1p / rx,
+            cx = cosPhi * cxp - sinPhi * cyp + (x0 + x) / 2,
+            cy = sinPhi * cxp + cosPhi * cyp + (y0 + y) / 2,
+            theta1 = std::atan2((y1p - cyp) / ry, (x1p - cxp) / rx);
+
+    number_t dtheta = std::atan2((-y1p - cyp) / ry, (-x1p - cxp) / rx) - theta1;
+    if (sweep && dtheta < 0) dtheta += tau;
+    else if (!sweep && dtheta > 0) dtheta -= tau;
+
+    // Circles map back onto arc(), which Path writes as "A" again.
+    if (std::abs(rx - ry) <= epsilon * rx) {
+        out.arc(cx, cy, rx, theta1 + phi, theta1 + phi + dtheta, !sweep);
+        return;
+    }
+
+    // Otherwise one cubic per quarter turn at most, mapped from the unit circle.
+    int n = static_cast<int>( std::ceil(std::abs(dtheta) / (pi / 2) - epsilon) );
+    if (n < 1) n = 1;
+    const number_t
+            step = dtheta / n,
+            t = 4 * std::tan(step / 4) / 3;
+
+    const auto mapX = [&](number_t ux, number_t uy) { return cx + rx * ux * cosPhi - ry * uy * sinPhi; };
+    const auto mapY = [&](number_t ux, number_t uy) { return cy + rx * ux * sinPhi + ry * uy * cosPhi; };
+
+    for (int i = 0; i < n; ++i) {
+        const number_t
+                a0 = theta1 + i * step,
+                a1 = a0 + step,
+                c0 = std::cos(a0), s0 = std::sin(a0),
+                c1 = std::cos(a1), s1 = std::sin(a1);
+        const bool last = (i + 1 == n);
+        out.bezierCurveTo(mapX(c0 - t * s0, s0 + t * c0), mapY(c0 - t * s0, s0 + t * c0),
+                          mapX(c1 + t * s1, s1 - t * c1), mapY(c1 + t * s1, s1 - t * c1),
+                          last ? x : mapX(c1, s1),        last ? y : mapY(c1, s1));
+    }
+}
+
+} // namespace
+
+void parsePath(const std::string& data, PathInterface& out)
+{
+    Parser parser(data);
+
+    number_t
+            x0 = 0, y0 = 0, // subpath start
+            x = 0, y = 0,   // current point
+            cx = 0, cy = 0; // last control point, for S and T
+    char command = 0, previous = 0;
+
+    while (!parser.atEnd()) {
+        const char next = parser.command();
+        if (next != 0) {
+            command = next;
+        }
+        else if (command == 0 || command == 'Z' || command == 'z') {
+            throw std::runtime_error("invalid path data: command expected");
+        }
+        else if (command == 'M') {
+            command = 'L'; // implicit lineTo after the first pair
+        }
+        else if (command == 'm') {
+            command = 'l';
+        }
+
+        const bool relative = (command >= 'a' && command <= 'z');
+        const number_t ox = relative ? x : 0, oy = relative ? y : 0;
+        const char upper = relative ? static_cast<char>(command - 'a' + 'A') : command;
+
+        switch (upper) {
+        case 'M': {
+            x = x0 = ox + parser.number();
+            y = y0 = oy + parser.number();
+            out.moveTo(x, y);
+            break;
+        }
+        case 'Z': {
+            out.closePath();
+            x = x0;
+            y = y0;
+            break;
+        }
+        case 'L': {
+            x = ox + parser.number();
+            y = oy + parser.number();
+            out.lineTo(x, y);
+            break;
+        }
+        case 'H': {
+            x = ox + parser.number();
+            out.lineTo(x, y);
+            break;
+        }
+        case 'V': {
+            y = oy + parser.number();
+            out.lineTo(x, y);
+            break;
+        }
+        case 'C':
+        case 'S': {
+            number_t x1, y1;
+            if (upper == 'C') {
+                x1 = ox + parser.number();
+                y1 = oy + parser.number();
+            }
+            else if (previous == 'C' || previous == 'S') {
+                x1 = 2 * x - cx;
+                y1 = 2 * y - cy;
+            }
+            else {
+                x1 = x;
+                y1 = y;
+            }
+            cx = ox + parser.number();
+            cy = oy + parser.number();
+            x = ox + parser.number();
+            y = oy + parser.number();
+            out.bezierCurveTo(x1, y1, cx, cy, x, y);
+            break;
+        }
+        case 'Q':
+        case 'T': {
+            if (upper == 'Q') {
+                cx = ox + parser.number();
+                cy = oy + parser.number();
+            }
+            else if (previous == 'Q' || previous == 'T') {
+                cx = 2 * x - cx;
+                cy = 2 * y - cy;
+            }
+            else {
+                cx = x;
+                cy = y;
+            }
+            x = ox + parser.number();
+            y = oy + parser.number();
+            out.quadraticCurveTo(cx, cy, x, y);
+            break;
+        }
+        case 'A': {
+            const number_t
+                    rx = parser.number(),
+                    ry = parser.number(),
+                    angle = parser.number();
+            const bool
+                    largeArc = parser.flag(),
+                    sweep = parser.flag();
+            const number_t
+                    ex = ox + parser.number(),
+                    ey = oy + parser.number();
+            ellipticalArc(out, x, y, rx, ry, angle, largeArc, sweep, ex, ey);
+            x = ex;
+            y = ey;
+            break;
+        }
+        default:
+            throw std::runtime_error(std::string("invalid path data: unknown command ") + command);
+        }
+
+        previous = upper;
+    }
+}
+
+} // namespace d3_path
@@ -0,0 +1,19 @@
+#ifndef D3__PATH__PATH_PARSER_HPP
+#define D3__PATH__PATH_PARSER_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+namespace d3_path {
+
+/**
+ * Parses SVG path data - every command, absolute and relative - and
+ * replays it into `out`, the inverse of Path::toString().
+ *
+ * Circular arcs ("A r,r,…") become arc() calls; elliptical or rotated
+ * ones become cubic Béziers. Throws std::runtime_error on malformed data.
+ */
+void parsePath(const std::string& data, PathInterface& out);
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_PARSER_HPP
@@ -0,0 +1,74 @@
+#include "d3_path/PathPool.hpp"
+
+#include <utility> // for std::move()
+
+namespace d3_path {
+
+PooledPath::PooledPath(PathPool* pool, Path&& path)
+    : _pool( pool )
+    , _path( std::move(path) )
+    , _owned( true )
+{ }
+
+PooledPath::PooledPath(PooledPath&& other)
+    : _pool( other._pool )
+    , _path( std::move(other._path) )
+    , _owned( other._owned )
+{
+    other._owned = false;
+}
+
+PooledPath& PooledPath::operator=(PooledPath&& other)
+{
+    if (this != &other) {
+        if (this->_owned) (this->_pool ? *this->_pool : PathPool::local()).recycle(std::move(this->_path));
+        this->_pool = other._pool;
+        this->_path = std::move(other._path);
+        this->_owned = other._owned;
+        other._owned = false;
+    }
+    return *this;
+}
+
+PooledPath::~PooledPath()
+{
+    if (this->_owned) (this->_pool ? *this->_pool : PathPool::local()).recycle(std::move(this->_path));
+}
+
+PathPool::PathPool(const PathPoolOptions& options)
+    : _options( options )
+{ }
+
+PathPool& PathPool::local()
+{
+    thread_local PathPool pool;
+    return pool;
+}
+
+PooledPath PathPool::acquire()
+{
+    PathPool* owner = (this == &PathPool::local()) ? nullptr : this;
+
+    if (this->_free.empty()) return PooledPath(owner, Path());
+
+    PooledPath handle(owner, std::move(this->_free.back()));
+    this->_free.pop_back();
+    return handle;
+}
+
+void PathPool::recycle(Path&& path)
+{
+    if (this->_free.size() >= this->_options.maxPooled) return;
+
+    path.clear();
+    if (path.capacity() > this->_options.maxCapacity) path.shrinkToFit();
+    this->_free.push_back(std::move(path));
+}
+
+void PathPool::setOptions(const PathPoolOptions& options)
+{
+    this->_options = options;
+    if (this->_free.size() > options.maxPooled) this->_free.resize(options.maxPooled);
+}
+
+} // namespace d3_path
@@ -0,0 +1,116 @@
+#ifndef D3__PATH__PATH_POOL_HPP
+#define D3__PATH__PATH_POOL_HPP
+
+#include "d3_path/Path.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+struct PathPoolOptions
+{
+    /**
+     * Most paths kept on a free list; returns beyond it are freed.
+     */
+    std::size_t maxPooled;
+
+    /**
+     * High-water mark: a returned path whose buffer grew beyond this many
+     * bytes gives it back before being pooled, so one huge path doesn't
+     * pin its memory.
+     */
+    std::size_t maxCapacity;
+
+    PathPoolOptions()
+        : maxPooled( 256 )
+        , maxCapacity( 64 * 1024 )
+    { }
+};
+
+class PathPool;
+
+/**
+ * A Path on loan from a PathPool, cleared, with the capacity its buffer
+ * had; it goes back to the pool when the handle is destroyed. Move-only.
+ *
+ * Handles from PathPool::local() go back to the free list of the thread
+ * destroying them, so they may be handed to other threads.
+ */
+class PooledPath
+{
+    friend class PathPool;
+
+    PathPool* _pool; // nullptr: the destroying thread's local() pool
+    Path      _path;
+    bool      _owned;
+
+    PooledPath(PathPool* pool, Path&& path);
+
+public:
+
+    PooledPath(PooledPath&& other);
+
+    PooledPath& operator=(PooledPath&& other);
+
+    ~PooledPath();
+
+    PooledPath(const PooledPath&) = delete;
+    PooledPath& operator=(const PooledPath&) = delete;
+
+    Path& operator*()  { return this->_path; }
+    Path* operator->() { return &this->_path; }
+
+    const Path& operator*() const  { return this->_path; }
+    const Path* operator->() const { return &this->_path; }
+};
+
+/**
+ * A free list of Paths whose buffers keep their capacity across uses.
+ * A pool is not synchronized: use one per thread, which is what local()
+ * gives, without locks.
+ */
+class PathPool
+{
+    friend class PooledPath;
+
+    std::vector<Path> _free;
+    PathPoolOptions   _options;
+
+    void recycle(Path&& path);
+
+public:
+
+    explicit PathPool(const PathPoolOptions& options = PathPoolOptions());
+
+    PathPool(const PathPool&) = delete;
+    PathPool& operator=(const PathPool&) = delete;
+
+    /**
+     * The calling thread's pool.
+     */
+    static PathPool& local();
+
+    PooledPath acquire();
+
+    const PathPoolOptions& options() const { return this->_options; }
+
+    /**
+     * Applies to later returns; trims the free list to `options.maxPooled`.
+     */
+    void setOptions(const PathPoolOptions& options);
+
+    /**
+     * Number of paths on the free list.
+     */
+    std::size_t size() const { return this->_free.size(); }
+
+    /**
+     * Frees every pooled path.
+     */
+    void clear() { this->_free.clear(); }
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_POOL_HPP
@@ -0,0 +1,171 @@
+#include "d3_path/PathQuantizer.hpp"
+
+#include <cmath> // for std::llround()
+
+namespace d3_path {
+
+PathQuantizer::PathQuantizer(PathInterface& target, number_t grid)
+    : _target( target )
+    , _grid( grid )
+    , _hasStart( false )
+    , _sx( 0 ), _sy( 0 )
+    , _hasLast( false )
+    , _lx( 0 ), _ly( 0 )
+    , _hasPending( false )
+    , _px( 0 ), _py( 0 )
+    , _dropped( 0 )
+{ }
+
+PathQuantizer::unit_t PathQuantizer::snap(number_t v) const
+{
+    return std::llround(v / this->_grid);
+}
+
+void PathQuantizer::flushPending() const
+{
+    if (this->_hasPending) {
+        this->_target.lineTo(this->unsnap(this->_px), this->unsnap(this->_py));
+        this->_lx = this->_px; this->_ly = this->_py;
+        this->_hasPending = false;
+    }
+}
+
+void PathQuantizer::flush()
+{
+    this->flushPending();
+}
+
+void PathQuantizer::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushPending();
+
+    this->_sx = this->_lx = this->snap(x);
+    this->_sy = this->_ly = this->snap(y);
+    this->_hasStart = this->_hasLast = true;
+
+    this->_target.moveTo(this->unsnap(this->_lx), this->unsnap(this->_ly));
+}
+
+void PathQuantizer::closePath()
+{
+    this->flushPending();
+    this->_target.closePath();
+
+    this->_lx = this->_sx;
+    this->_ly = this->_sy;
+    this->_hasLast = this->_hasStart;
+}
+
+void PathQuantizer::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    const unit_t
+            qx = this->snap(x),
+            qy = this->snap(y);
+
+    // No current point: nothing to compare against.
+    if (!this->_hasLast) {
+        this->_target.lineTo(this->unsnap(qx), this->unsnap(qy));
+        this->_lx = qx; this->_ly = qy;
+        this->_hasLast = true;
+        return;
+    }
+
+    if (!this->_hasPending) {
+        if (qx == this->_lx && qy == this->_ly) {
+            this->_dropped += 1;
+        }
+        else {
+            this->_px = qx; this->_py = qy;
+            this->_hasPending = true;
+        }
+        return;
+    }
+
+    // Zero-length segment after snapping? Drop it.
+    if (qx == this->_px && qy == this->_py) {
+        this->_dropped += 1;
+        return;
+    }
+
+    // Is the pending point on the straight line from the last emitted point
+    // to this one, and not a turnaround? Replace it.
+    const unit_t
+            ux = this->_px - this->_lx,
+            uy = this->_py - this->_ly,
+            vx = qx - this->_px,
+            vy = qy - this->_py;
+
+    if (ux * vy - uy * vx == 0 && ux * vx + uy * vy > 0) {
+        this->_px = qx; this->_py = qy;
+        this->_dropped += 1;
+        return;
+    }
+
+    this->_target.lineTo(this->unsnap(this->_px), this->unsnap(this->_py));
+    this->_lx = this->_px; this->_ly = this->_py;
+    this->_px = qx;        this->_py = qy;
+}
+
+void PathQuantizer::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushPending();
+
+    this->_lx = this->snap(x);
+    this->_ly = this->snap(y);
+    this->_hasLast = true;
+
+    this->_target.quadraticCurveTo(this->unsnap(this->snap(x1)), this->unsnap(this->snap(y1)),
+                                   this->unsnap(this->_lx), this->unsnap(this->_ly));
+}
+
+void PathQuantizer::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushPending();
+
+    this->_lx = this->snap(x);
+    this->_ly = this->snap(y);
+    this->_hasLast = true;
+
+    this->_target.bezierCurveTo(this->unsnap(this->snap(x1)), this->unsnap(this->snap(y1)),
+                                this->unsnap(this->snap(x2)), this->unsnap(this->snap(y2)),
+                                this->unsnap(this->_lx), this->unsnap(this->_ly));
+}
+
+void PathQuantizer::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    this->flushPending();
+
+    this->_target.arcTo(this->unsnap(this->snap(x1)), this->unsnap(this->snap(y1)),
+                        this->unsnap(this->snap(x2)), this->unsnap(this->snap(y2)), r);
+
+    this->_hasLast = false; // the tangent point is off the grid
+}
+
+void PathQuantizer::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    this->flushPending();
+
+    this->_target.arc(this->unsnap(this->snap(x)), this->unsnap(this->snap(y)), r, a0, a1, ccw);
+
+    this->_hasLast = false; // the end point is off the grid
+}
+
+void PathQuantizer::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->flushPending();
+
+    this->_sx = this->_lx = this->snap(x);
+    this->_sy = this->_ly = this->snap(y);
+    this->_hasStart = this->_hasLast = true;
+
+    this->_target.rect(this->unsnap(this->_lx), this->unsnap(this->_ly),
+                       this->unsnap(this->snap(x + w) - this->_lx), this->unsnap(this->snap(y + h) - this->_ly));
+}
+
+std::string PathQuantizer::toString() const
+{
+    this->flushPending();
+    return this->_target.toString();
+}
+
+} // namespace d3_path
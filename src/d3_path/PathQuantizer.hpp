@@ -0,0 +1,85 @@
+#ifndef D3__PATH__PATH_QUANTIZER_HPP
+#define D3__PATH__PATH_QUANTIZER_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <cstdint> // for std::int64_t
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * A PathInterface decorator that snaps every point to a grid (e.g. 1/8 px)
+ * and, in the same pass, drops lineTo commands that draw nothing: segments
+ * of zero length after snapping and interior points of straight runs.
+ *
+ * The last lineTo is held back until the next command, flush() or toString().
+ *
+ * Snapping happens in integer grid units, so collinearity tests are exact.
+ * Radii and angles are forwarded unchanged; rect corners are snapped.
+ */
+class PathQuantizer : public PathInterface
+{
+    PathInterface& _target;
+    number_t       _grid;
+
+    using unit_t = std::int64_t;
+
+    bool   _hasStart;
+    unit_t _sx, _sy; // start of current subpath
+
+    mutable bool   _hasLast;
+    mutable unit_t _lx, _ly; // last emitted point
+
+    // Last lineTo point, held back until we know it is not collinear with the next one.
+    mutable bool   _hasPending;
+    mutable unit_t _px, _py;
+
+    std::size_t _dropped;
+
+    unit_t   snap(number_t v) const;
+    number_t unsnap(unit_t u) const { return u * this->_grid; }
+
+    void flushPending() const;
+
+public:
+
+    PathQuantizer(PathInterface& target, number_t grid = 0.125);
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t r) override;
+
+    void arc(number_t x, number_t y, number_t r, number_t a0, number_t a1, bool ccw = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+
+    /**
+     * Forwards the pending lineTo (if any) and returns the target's string.
+     */
+    std::string toString() const override;
+
+    /**
+     * Forwards the pending lineTo (if any) to the target. Call it at the end
+     * of a series when the target is not read through toString() (e.g. a
+     * RecordedPath or a Rasterizer), or its last point is missing.
+     */
+    void flush();
+
+    /**
+     * Number of lineTo commands dropped so far.
+     */
+    std::size_t dropped() const { return this->_dropped; }
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_QUANTIZER_HPP
@@ -0,0 +1,284 @@
+#include "d3_path/PathSimplifier.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+#include <limits>     // for std::numeric_limits<T>::infinity()
+#include <cmath>      // for std::isnan(), std::abs()
+#include <algorithm>  // for std::make_heap(), std::push_heap(), std::pop_heap()
+#include <functional> // for std::greater<T>
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+
+namespace {
+
+using number_t = PathInterface::number_t;
+
+// Squared distance from ⟨px, py⟩ to the segment ⟨ax, ay⟩ - ⟨bx, by⟩.
+inline number_t segmentDistance2(number_t px, number_t py, number_t ax, number_t ay, number_t bx, number_t by)
+{
+    const number_t
+            dx = bx - ax,
+            dy = by - ay,
+            l2 = dx * dx + dy * dy;
+
+    number_t t = 0;
+    if (l2 > 0) {
+        t = ((px - ax) * dx + (py - ay) * dy) / l2;
+        if (t < 0) t = 0; else if (t > 1) t = 1;
+    }
+
+    const number_t
+            ex = px - (ax + t * dx),
+            ey = py - (ay + t * dy);
+    return ex * ex + ey * ey;
+}
+
+// Area of the triangle formed by ⟨ax, ay⟩, ⟨bx, by⟩ and ⟨cx, cy⟩.
+inline number_t triangleArea(number_t ax, number_t ay, number_t bx, number_t by, number_t cx, number_t cy)
+{
+    return std::abs((bx - ax) * (cy - ay) - (cx - ax) * (by - ay)) / 2;
+}
+
+} // namespace
+
+PathSimplifier::PathSimplifier(PathInterface& target, number_t tolerance, Algorithm algorithm)
+    : _target( target )
+    , _tolerance( tolerance )
+    , _algorithm( algorithm )
+    , _x0( NULL_NUMBER )
+    , _y0( NULL_NUMBER )
+    , _verticesIn( 0 )
+    , _verticesOut( 0 )
+{ }
+
+void PathSimplifier::anchor(number_t x, number_t y)
+{
+    this->_run.clear();
+    this->_run.push_back( Point{x, y} );
+}
+
+void PathSimplifier::simplifyDouglasPeucker() const
+{
+    const std::size_t n = this->_run.size();
+    const number_t tolerance2 = this->_tolerance * this->_tolerance;
+
+    // Explicit stack of [first, last] ranges instead of recursion, so very
+    // long runs can't overflow the call stack.
+    this->_stack.clear();
+    this->_stack.push_back(0);
+    this->_stack.push_back(n - 1);
+
+    while ( !this->_stack.empty() ) {
+        const std::size_t last  = this->_stack.back(); this->_stack.pop_back();
+        const std::size_t first = this->_stack.back(); this->_stack.pop_back();
+
+        const Point& a = this->_run[first];
+        const Point& b = this->_run[last];
+
+        number_t    maxDistance2 = 0;
+        std::size_t index = 0;
+
+        for (std::size_t i = first + 1; i < last; ++i) {
+            const Point& p = this->_run[i];
+            const number_t d2 = segmentDistance2(p.x, p.y, a.x, a.y, b.x, b.y);
+            if (d2 > maxDistance2) {
+                maxDistance2 = d2;
+                index = i;
+            }
+        }
+
+        if (maxDistance2 > tolerance2) {
+            this->_keep[index] = 1;
+            if (index - first > 1) { this->_stack.push_back(first); this->_stack.push_back(index); }
+            if (last - index > 1)  { this->_stack.push_back(index); this->_stack.push_back(last);  }
+        }
+    }
+}
+
+void PathSimplifier::simplifyVisvalingamWhyatt() const
+{
+    const std::size_t n = this->_run.size();
+    const number_t threshold = this->_tolerance * this->_tolerance;
+    const number_t infinity = std::numeric_limits<number_t>::infinity();
+
+    // Doubly-linked list of the remaining points: prev[i] = _stack[2*i], next[i] = _stack[2*i + 1]
+    this->_stack.resize(2 * n);
+    this->_areas.assign(n, infinity);
+    std::vector<number_t>& areas = this->_areas;
+
+    const auto area = [this](std::size_t i, std::size_t prev, std::size_t next) {
+        const Point& a = this->_run[prev];
+        const Point& b = this->_run[i];
+        const Point& c = this->_run[next];
+        return triangleArea(a.x, a.y, b.x, b.y, c.x, c.y);
+    };
+
+    // Min-heap of (area, index) with lazy deletion.
+    std::vector<HeapEntry>& heap = this->_heap;
+    heap.clear();
+    const auto push = [&heap](number_t a, std::size_t i) {
+        heap.push_back( HeapEntry(a, i) );
+        std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+    };
+
+    // Only points below the threshold are candidates for removal; the others
+    // enter the heap later, if ever, once a neighbour removal shrinks them.
+    for (std::size_t i = 0; i < n; ++i) {
+        this->_stack[2 * i]     = i - 1;
+        this->_stack[2 * i + 1] = i + 1;
+        if (i > 0 && i < n - 1) {
+            areas[i] = area(i, i - 1, i + 1);
+            if (areas[i] < threshold) heap.push_back( HeapEntry(areas[i], i) );
+        }
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+
+    while ( !heap.empty() ) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+        const HeapEntry top = heap.back(); heap.pop_back();
+        const std::size_t i = top.second;
+
+        // Stale entry: the point was removed or its area was updated since.
+        if (!this->_keep[i] || top.first != areas[i]) continue;
+
+        this->_keep[i] = 0;
+
+        const std::size_t prev = this->_stack[2 * i];
+        const std::size_t next = this->_stack[2 * i + 1];
+        this->_stack[2 * prev + 1] = next;
+        this->_stack[2 * next]     = prev;
+
+        // Recompute the neighbours, never letting their area drop below the
+        // area just eliminated (so removal order stays monotonic).
+        if (prev > 0) {
+            number_t a = area(prev, this->_stack[2 * prev], next);
+            if (a < top.first) a = top.first;
+            areas[prev] = a;
+            if (a < threshold) push(a, prev);
+        }
+        if (next < n - 1) {
+            number_t a = area(next, prev, this->_stack[2 * next + 1]);
+            if (a < top.first) a = top.first;
+            areas[next] = a;
+            if (a < threshold) push(a, next);
+        }
+    }
+}
+
+void PathSimplifier::flushRun() const
+{
+    const std::size_t n = this->_run.size();
+    if (n < 2) return;
+
+    this->_verticesIn += n - 1;
+
+    if (n == 2) {
+        this->_target.lineTo(this->_run[1].x, this->_run[1].y);
+        this->_verticesOut += 1;
+    }
+    else {
+        if (this->_algorithm == Algorithm::DouglasPeucker) {
+            this->_keep.assign(n, 0);
+            this->_keep[0] = this->_keep[n - 1] = 1;
+            this->simplifyDouglasPeucker();
+        }
+        else {
+            this->_keep.assign(n, 1);
+            this->simplifyVisvalingamWhyatt();
+        }
+
+        for (std::size_t i = 1; i < n; ++i) {
+            if (this->_keep[i]) {
+                this->_target.lineTo(this->_run[i].x, this->_run[i].y);
+                this->_verticesOut += 1;
+            }
+        }
+    }
+
+    // The last point of this run is the anchor of the next one.
+    this->_run[0] = this->_run[n - 1];
+    this->_run.resize(1);
+}
+
+void PathSimplifier::flush()
+{
+    this->flushRun();
+}
+
+void PathSimplifier::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushRun();
+    this->_target.moveTo(this->_x0 = x, this->_y0 = y);
+    this->anchor(x, y);
+}
+
+void PathSimplifier::closePath()
+{
+    this->flushRun();
+    this->_target.closePath();
+    if ( std::isnan( this->_x0 ) == false ) {
+        this->anchor(this->_x0, this->_y0);
+    }
+    else {
+        this->_run.clear();
+    }
+}
+
+void PathSimplifier::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    // No known current point: nothing to simplify against, start a new run.
+    if ( this->_run.empty() ) {
+        this->_target.lineTo(x, y);
+        this->_verticesIn += 1;
+        this->_verticesOut += 1;
+        this->anchor(x, y);
+    }
+    else {
+        this->_run.push_back( Point{x, y} );
+    }
+}
+
+void PathSimplifier::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushRun();
+    this->_target.quadraticCurveTo(x1, y1, x, y);
+    this->anchor(x, y);
+}
+
+void PathSimplifier::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->flushRun();
+    this->_target.bezierCurveTo(x1, y1, x2, y2, x, y);
+    this->anchor(x, y);
+}
+
+void PathSimplifier::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    this->flushRun();
+    this->_target.arcTo(x1, y1, x2, y2, r);
+    this->_run.clear(); // end point is only known to the target
+}
+
+void PathSimplifier::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    this->flushRun();
+    this->_target.arc(x, y, r, a0, a1, ccw);
+    this->_run.clear(); // end point is only known to the target
+}
+
+void PathSimplifier::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->flushRun();
+    this->_target.rect(this->_x0 = x, this->_y0 = y, w, h);
+    this->anchor(x, y);
+}
+
+std::string PathSimplifier::toString() const
+{
+    this->flushRun();
+    return this->_target.toString();
+}
+
+} // namespace d3_path
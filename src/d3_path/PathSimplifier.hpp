@@ -0,0 +1,99 @@
+#ifndef D3__PATH__PATH_SIMPLIFIER_HPP
+#define D3__PATH__PATH_SIMPLIFIER_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+#include <utility> // for std::pair<T1, T2>
+
+namespace d3_path {
+
+/**
+ * A PathInterface decorator that simplifies every run of consecutive lineTo
+ * commands within the given tolerance (in output units, e.g. pixels) before
+ * the run reaches the target path.
+ *
+ * Only the current run is buffered: it is simplified and forwarded as soon as
+ * any other command arrives (or flush() / toString() is called), so memory is
+ * bounded by the longest lineTo run instead of the whole path.
+ */
+class PathSimplifier : public PathInterface
+{
+public:
+
+    enum class Algorithm {
+        DouglasPeucker,    // keeps points farther than tolerance from the simplified line
+        VisvalingamWhyatt, // drops points whose effective area is below tolerance²
+    };
+
+private:
+
+    struct Point { number_t x, y; };
+
+    PathInterface& _target;
+    number_t       _tolerance;
+    Algorithm      _algorithm;
+
+    number_t _x0, _y0; // start of current subpath
+
+    // Current lineTo run; the first point is the anchor, already emitted.
+    mutable std::vector<Point> _run;
+
+    // Scratch buffers, kept between runs to avoid reallocation.
+    mutable std::vector<std::size_t> _stack;
+    mutable std::vector<char>        _keep;
+    mutable std::vector<number_t>    _areas;
+
+    using HeapEntry = std::pair<number_t, std::size_t>;
+    mutable std::vector<HeapEntry>   _heap;
+
+    mutable std::size_t _verticesIn;
+    mutable std::size_t _verticesOut;
+
+    void flushRun() const;
+    void simplifyDouglasPeucker() const;
+    void simplifyVisvalingamWhyatt() const;
+
+    void anchor(number_t x, number_t y);
+
+public:
+
+    PathSimplifier(PathInterface& target, number_t tolerance = 0.5, Algorithm algorithm = Algorithm::DouglasPeucker);
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t r) override;
+
+    void arc(number_t x, number_t y, number_t r, number_t a0, number_t a1, bool ccw = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+
+    /**
+     * Flushes the pending lineTo run and returns the target's string.
+     */
+    std::string toString() const override;
+
+    /**
+     * Simplifies and forwards the pending lineTo run to the target.
+     */
+    void flush();
+
+    /**
+     * Number of lineTo vertices received / forwarded so far (pending run excluded).
+     */
+    std::size_t verticesIn() const { return _verticesIn; }
+    std::size_t verticesOut() const { return _verticesOut; }
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_SIMPLIFIER_HPP
@@ -0,0 +1,115 @@
+#include "d3_path/PathTransform.hpp"
+
+#include <cmath>     // for std::isnan(), std::atan2()
+#include <algorithm> // for std::min()
+
+namespace d3_path {
+
+PathTransform::PathTransform(PathInterface& target, const AffineTransform& transform)
+    : _target( target )
+{
+    this->setTransform(transform);
+}
+
+void PathTransform::setTransform(const AffineTransform& transform)
+{
+    this->_transform  = transform;
+    this->_similarity = transform.isSimilarity();
+    this->_reflection = transform.determinant() < 0;
+    this->_scale      = transform.scaleFactor();
+    this->_rotation   = std::atan2(transform.b, transform.a);
+}
+
+void PathTransform::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    const AffineTransform& t = this->_transform;
+    this->_target.moveTo(t.applyX(x, y), t.applyY(x, y));
+}
+
+void PathTransform::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    const AffineTransform& t = this->_transform;
+    this->_target.lineTo(t.applyX(x, y), t.applyY(x, y));
+}
+
+void PathTransform::emitQuadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    // Béziers are affine-invariant: transforming the control points is exact.
+    const AffineTransform& t = this->_transform;
+    this->_target.quadraticCurveTo(t.applyX(x1, y1), t.applyY(x1, y1), t.applyX(x, y), t.applyY(x, y));
+}
+
+void PathTransform::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    const AffineTransform& t = this->_transform;
+    this->_target.bezierCurveTo(t.applyX(x1, y1), t.applyY(x1, y1), t.applyX(x2, y2), t.applyY(x2, y2), t.applyX(x, y), t.applyY(x, y));
+}
+
+void PathTransform::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    // A non-uniform scale or skew turns the circle into an ellipse: fall back to cubics.
+    if ( !this->_similarity ) {
+        PathNormalizer::emitArc(cx, cy, r, a0, da);
+        return;
+    }
+
+    // A rotation by θ maps angle φ to θ + φ; a reflection maps it to θ - φ.
+    const AffineTransform& t = this->_transform;
+    const number_t
+            start = this->_reflection ? this->_rotation - a0 : this->_rotation + a0,
+            sweep = this->_reflection ? -da : da;
+
+    this->_target.arc(t.applyX(cx, cy), t.applyY(cx, cy), r * this->_scale, start, start + sweep, sweep < 0);
+}
+
+void PathTransform::emitClosePath()
+{
+    this->_target.closePath();
+}
+
+void PathTransform::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    const AffineTransform& t = this->_transform;
+
+    if ( t.isScaleTranslate() ) {
+        this->_target.rect(t.applyX(x, y), t.applyY(x, y), w * t.a, h * t.d);
+    }
+    else {
+        PathNormalizer::emitRect(x, y, w, h);
+    }
+}
+
+void PathTransform::lineTo(const PathInterface::number_t* xs, const PathInterface::number_t* ys, std::size_t n)
+{
+    if (n == 0) return;
+
+    std::size_t i = 0;
+
+    // The first point of an empty path becomes a moveTo.
+    if ( std::isnan( this->_x1 ) == true ) {
+        this->lineTo(xs[0], ys[0]);
+        i = 1;
+    }
+
+    const std::size_t batch = 256;
+    number_t tx[batch], ty[batch];
+
+    while (i < n) {
+        const std::size_t m = std::min(batch, n - i);
+        transformPoints(this->_transform, xs + i, ys + i, m, tx, ty);
+        for (std::size_t k = 0; k < m; ++k) {
+            this->_target.lineTo(tx[k], ty[k]);
+        }
+        i += m;
+    }
+
+    this->_x1 = xs[n - 1];
+    this->_y1 = ys[n - 1];
+}
+
+std::string PathTransform::toString() const
+{
+    return this->_target.toString();
+}
+
+} // namespace d3_path
@@ -0,0 +1,64 @@
+#ifndef D3__PATH__PATH_TRANSFORM_HPP
+#define D3__PATH__PATH_TRANSFORM_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+#include "d3_path/AffineTransform.hpp"
+
+namespace d3_path {
+
+/**
+ * A PathInterface decorator that applies an affine transform to every
+ * coordinate before forwarding it to the target path.
+ *
+ * Arcs stay arcs (with scaled radius and rotated / mirrored angles) while the
+ * transform is a similarity; otherwise they are forwarded as cubic Béziers.
+ * Rectangles stay rectangles under scale + translate.
+ */
+class PathTransform : public PathNormalizer
+{
+    PathInterface&  _target;
+    AffineTransform _transform;
+
+    // Cached properties of _transform.
+    bool     _similarity;
+    bool     _reflection;
+    number_t _scale;
+    number_t _rotation;
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitQuadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+    void emitRect(number_t x, number_t y, number_t w, number_t h) override;
+
+public:
+
+    PathTransform(PathInterface& target, const AffineTransform& transform);
+
+    const AffineTransform& transform() const { return this->_transform; }
+
+    void setTransform(const AffineTransform& transform);
+
+    using PathNormalizer::lineTo;
+
+    /**
+     * Draws straight lines to the `n` points ⟨xs[i], ys[i]⟩, transformed in batches.
+     */
+    void lineTo(const number_t* xs, const number_t* ys, std::size_t n);
+
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PATH_TRANSFORM_HPP
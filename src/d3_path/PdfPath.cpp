@@ -0,0 +1,242 @@
+#include "d3_path/PdfPath.hpp"
+
+#include "d3_path/detail/constants.hpp"
+#include "d3_path/detail/fixed.hpp"
+
+#include <cstdio>    // for std::snprintf()
+#include <stdexcept> // for std::runtime_error()
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+
+namespace {
+
+const std::size_t
+        BLOCK_SIZE = 1 << 16,
+        CATALOG = 1,
+        PAGE_TREE = 2;
+
+} // namespace
+
+PdfPath::PdfPath(Sink& sink, int precision)
+    : _sink( sink )
+    , _precision( precision < 0 ? 0 : precision > detail::MAX_FIXED_PRECISION ? detail::MAX_FIXED_PRECISION : precision )
+    , _written( 0 )
+    , _streamStart( 0 )
+    , _offsets( 3, 0 ) // 0 (free), catalog and page tree, written by finish()
+    , _width( 0 )
+    , _height( 0 )
+    , _inPage( false )
+    , _finished( false )
+{
+    // Binary comment: tells transfer tools the file isn't plain text.
+    this->_buffer = "%PDF-1.4\n%\xE2\xE3\xCF\xD3\n";
+}
+
+std::size_t PdfPath::newObject()
+{
+    this->_offsets.push_back(0);
+    return this->_offsets.size() - 1;
+}
+
+std::size_t PdfPath::beginObject(std::size_t id)
+{
+    this->_offsets[id] = this->offset();
+    this->_buffer += std::to_string(id);
+    this->_buffer += " 0 obj\n";
+    return id;
+}
+
+void PdfPath::put(PathInterface::number_t value)
+{
+    detail::appendFixed(this->_buffer, value, this->_precision);
+    this->_buffer += ' ';
+}
+
+void PdfPath::put(const char* op)
+{
+    this->_buffer += op;
+    this->_buffer += '\n';
+    this->flushIfFull();
+}
+
+void PdfPath::flushIfFull()
+{
+    if (this->_buffer.size() >= BLOCK_SIZE) this->flush();
+}
+
+void PdfPath::flush()
+{
+    this->_sink.write(this->_buffer);
+    this->_written += this->_buffer.size();
+    this->_buffer.clear();
+}
+
+void PdfPath::requirePage() const
+{
+    if (this->_finished) throw std::runtime_error("PdfPath: document already finished");
+    if (!this->_inPage) throw std::runtime_error("PdfPath: no current page, call beginPage() first");
+}
+
+void PdfPath::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requirePage();
+    this->put(x); this->put(y);
+    this->put("m");
+}
+
+void PdfPath::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requirePage();
+    this->put(x); this->put(y);
+    this->put("l");
+}
+
+void PdfPath::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->requirePage();
+    this->put(x1); this->put(y1);
+    this->put(x2); this->put(y2);
+    this->put(x);  this->put(y);
+    this->put("c");
+}
+
+void PdfPath::emitClosePath()
+{
+    this->requirePage();
+    this->put("h");
+}
+
+void PdfPath::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    // "re" is moveTo + 3 lines + close from ⟨x, y⟩, like Path.
+    this->requirePage();
+    this->put(x); this->put(y);
+    this->put(w); this->put(h);
+    this->put("re");
+}
+
+void PdfPath::beginPage(PathInterface::number_t width, PathInterface::number_t height)
+{
+    if (this->_finished) throw std::runtime_error("PdfPath: document already finished");
+    if (this->_inPage) this->endPage();
+
+    const std::size_t
+            content = this->newObject(),
+            length = this->newObject();
+
+    this->beginObject(content);
+    this->_buffer += "<< /Length " + std::to_string(length) + " 0 R >>\nstream\n";
+    this->_streamStart = this->offset();
+
+    this->_width = width;
+    this->_height = height;
+    this->_inPage = true;
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+
+    // Flip to y-down page coordinates.
+    this->_buffer += "1 0 0 -1 0 ";
+    this->put(height);
+    this->put("cm");
+}
+
+void PdfPath::endPage()
+{
+    this->requirePage();
+
+    const std::size_t
+            length = this->offset() - this->_streamStart,
+            content = this->_offsets.size() - 2;
+
+    this->_buffer += "\nendstream\nendobj\n";
+
+    this->beginObject(content + 1);
+    this->_buffer += std::to_string(length) + "\nendobj\n";
+
+    const std::size_t page = this->beginObject(this->newObject());
+    this->_buffer += "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 ";
+    this->put(this->_width);
+    this->put(this->_height);
+    this->_buffer += "] /Contents " + std::to_string(content) + " 0 R /Resources << >> >>\nendobj\n";
+
+    this->_pages.push_back(page);
+    this->_inPage = false;
+    this->flushIfFull();
+}
+
+void PdfPath::setFillColor(PathInterface::number_t r, PathInterface::number_t g, PathInterface::number_t b)
+{
+    this->requirePage();
+    this->put(r); this->put(g); this->put(b);
+    this->put("rg");
+}
+
+void PdfPath::setStrokeColor(PathInterface::number_t r, PathInterface::number_t g, PathInterface::number_t b)
+{
+    this->requirePage();
+    this->put(r); this->put(g); this->put(b);
+    this->put("RG");
+}
+
+void PdfPath::setLineWidth(PathInterface::number_t width)
+{
+    this->requirePage();
+    this->put(width);
+    this->put("w");
+}
+
+void PdfPath::fill(FillRule rule)
+{
+    this->requirePage();
+    this->put(rule == FillRule::EvenOdd ? "f*" : "f");
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+void PdfPath::stroke()
+{
+    this->requirePage();
+    this->put("S");
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+void PdfPath::finish()
+{
+    if (this->_finished) return;
+    if (this->_inPage) this->endPage();
+
+    this->beginObject(PAGE_TREE);
+    this->_buffer += "<< /Type /Pages /Kids [";
+    for (const std::size_t page : this->_pages) {
+        this->_buffer += std::to_string(page);
+        this->_buffer += " 0 R ";
+        this->flushIfFull();
+    }
+    this->_buffer += "] /Count " + std::to_string(this->_pages.size()) + " >>\nendobj\n";
+
+    this->beginObject(CATALOG);
+    this->_buffer += "<< /Type /Catalog /Pages 2 0 R >>\nendobj\n";
+
+    // Cross-reference table: fixed 20-byte entries.
+    const std::size_t xref = this->offset();
+    this->_buffer += "xref\n0 " + std::to_string(this->_offsets.size()) + "\n0000000000 65535 f \n";
+    for (std::size_t id = 1; id < this->_offsets.size(); ++id) {
+        char entry[21];
+        std::snprintf(entry, sizeof(entry), "%010zu 00000 n \n", this->_offsets[id]);
+        this->_buffer.append(entry, 20);
+        this->flushIfFull();
+    }
+
+    this->_buffer += "trailer\n<< /Size " + std::to_string(this->_offsets.size()) + " /Root 1 0 R >>\n"
+                     "startxref\n" + std::to_string(xref) + "\n%%EOF\n";
+    this->flush();
+
+    this->_finished = true;
+}
+
+std::string PdfPath::toString() const
+{
+    return std::string();
+}
+
+} // namespace d3_path
@@ -0,0 +1,110 @@
+#ifndef D3__PATH__PDF_PATH_HPP
+#define D3__PATH__PDF_PATH_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+#include "d3_path/FillRule.hpp"
+#include "d3_path/Sink.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * A PathInterface that writes a PDF document to a Sink, one page at a
+ * time: path calls become content-stream operators (m l c h re), with
+ * arcs and quadratic curves converted to cubics.
+ *
+ * Nothing is kept per page but its object offsets: each content stream
+ * is written as it is drawn (its /Length follows it as an indirect
+ * object), and the xref table is written by finish() from the recorded
+ * offsets. Numbers are fixed-point with `precision` decimals, trailing
+ * zeros dropped.
+ *
+ * Page coordinates are in points with the origin at the top left and y
+ * pointing down, as in SVG. No text is produced: toString() returns an
+ * empty string.
+ */
+class PdfPath final : public PathNormalizer
+{
+    Sink& _sink;
+    int   _precision;
+
+    std::string _buffer;      // pending output, handed to the sink in blocks
+    std::size_t _written;     // bytes handed to the sink so far
+    std::size_t _streamStart; // offset of the current content stream data
+
+    std::vector<std::size_t> _offsets; // per object number (0 unused)
+    std::vector<std::size_t> _pages;   // page object numbers
+
+    number_t _width, _height;
+    bool     _inPage;
+    bool     _finished;
+
+    std::size_t offset() const { return this->_written + this->_buffer.size(); }
+
+    std::size_t beginObject(std::size_t id);
+
+    std::size_t newObject();
+
+    void put(number_t value);
+
+    void put(const char* op);
+
+    void flushIfFull();
+
+    void flush();
+
+    void requirePage() const;
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitClosePath() override;
+
+    void emitRect(number_t x, number_t y, number_t w, number_t h) override;
+
+public:
+
+    PdfPath(Sink& sink, int precision = 2);
+
+    PdfPath(const PdfPath&) = delete;
+    PdfPath& operator=(const PdfPath&) = delete;
+
+    /**
+     * Starts a page of `width` × `height` points. Path calls draw on the
+     * current page; the path is reset after every fill() or stroke().
+     */
+    void beginPage(number_t width, number_t height);
+
+    void endPage();
+
+    void setFillColor(number_t r, number_t g, number_t b);
+
+    void setStrokeColor(number_t r, number_t g, number_t b);
+
+    void setLineWidth(number_t width);
+
+    void fill(FillRule rule = FillRule::NonZero);
+
+    void stroke();
+
+    /**
+     * Ends the current page, if any, and writes the page tree, catalog,
+     * xref table and trailer. Calling anything but finish() afterwards throws.
+     */
+    void finish();
+
+    std::size_t pages() const { return this->_pages.size(); }
+
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__PDF_PATH_HPP
@@ -0,0 +1,312 @@
+#include "d3_path/Png.hpp"
+
+#include "d3_path/detail/parallel.hpp"
+
+#include <zlib.h>
+
+#include <atomic>
+#include <vector>
+#include <algorithm> // for std::min(), std::max()
+#include <stdexcept> // for std::runtime_error()
+#include <cstring>   // for std::memcpy()
+#include <cstdint>   // for std::uint8_t, std::uint32_t
+#include <cstdlib>   // for std::abs()
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace d3_path {
+
+namespace {
+
+const std::size_t
+        BPP = 4,             // bytes per pixel
+        WINDOW = 32768,      // deflate window: the dictionary each chunk is primed with
+        CHUNK_BYTES = 262144;
+
+enum Filter : unsigned { None = 0, Sub = 1, Up = 2, Average = 3, Paeth = 4 };
+
+// a: left, b: above, c: above-left.
+template <unsigned F>
+inline std::uint8_t predict(std::uint8_t a, std::uint8_t b, std::uint8_t c)
+{
+    if (F == Sub)     return a;
+    if (F == Up)      return b;
+    if (F == Average) return static_cast<std::uint8_t>((a + b) >> 1);
+    if (F == Paeth) {
+        const int
+                pa = std::abs(b - c),
+                pb = std::abs(a - c),
+                pc = std::abs(a + b - 2 * c);
+        if (pa <= pb && pa <= pc) return a;
+        return (pb <= pc) ? b : c;
+    }
+    return 0;
+}
+
+#if defined(__SSE2__)
+inline __m128i abs16(__m128i v)
+{
+    return _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+}
+
+// Paeth on 8 pixels bytes widened to 16 bits.
+inline __m128i paeth16(__m128i a, __m128i b, __m128i c)
+{
+    const __m128i
+            pa = abs16(_mm_sub_epi16(b, c)),
+            pb = abs16(_mm_sub_epi16(a, c)),
+            pc = abs16(_mm_sub_epi16(_mm_add_epi16(a, b), _mm_add_epi16(c, c))),
+            notA = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc)), // not (pa ≤ pb and pa ≤ pc)
+            useC = _mm_and_si128(notA, _mm_cmpgt_epi16(pb, pc)),
+            useB = _mm_andnot_si128(useC, notA);
+    return _mm_or_si128(_mm_andnot_si128(notA, a),
+           _mm_or_si128(_mm_and_si128(useB, b), _mm_and_si128(useC, c)));
+}
+
+template <unsigned F>
+inline __m128i predict(__m128i a, __m128i b, __m128i c)
+{
+    if (F == Sub)     return a;
+    if (F == Up)      return b;
+    if (F == Average) return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+    if (F == Paeth) {
+        const __m128i zero = _mm_setzero_si128();
+        return _mm_packus_epi16(
+                    paeth16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero)),
+                    paeth16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero)));
+    }
+    return _mm_setzero_si128();
+}
+#endif
+
+// Filters the `n` bytes of row `x` (prior row `b`) into `out`, returning the
+// sum of the filtered bytes taken as signed magnitudes - the usual heuristic.
+template <unsigned F>
+std::size_t filterRow(const std::uint8_t* x, const std::uint8_t* b, std::size_t n, std::uint8_t* out)
+{
+    std::size_t i = 0, sum = 0;
+
+    for (; i < BPP && i < n; ++i) {
+        out[i] = static_cast<std::uint8_t>(x[i] - predict<F>(0, b[i], 0));
+        sum += std::abs(static_cast<signed char>(out[i]));
+    }
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i total = zero;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i
+                v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)),
+                p = predict<F>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i - BPP)),
+                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)),
+                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i - BPP))),
+                f = _mm_sub_epi8(v, p);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), f);
+        total = _mm_add_epi64(total, _mm_sad_epu8(_mm_min_epu8(f, _mm_sub_epi8(zero, f)), zero));
+    }
+    sum += static_cast<std::size_t>(_mm_cvtsi128_si32(total)) + static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(total, 8)));
+#endif
+
+    for (; i < n; ++i) {
+        out[i] = static_cast<std::uint8_t>(x[i] - predict<F>(x[i - BPP], b[i], b[i - BPP]));
+        sum += std::abs(static_cast<signed char>(out[i]));
+    }
+    return sum;
+}
+
+typedef std::size_t (*FilterRow)(const std::uint8_t*, const std::uint8_t*, std::size_t, std::uint8_t*);
+
+const FilterRow FILTERS[5] = { filterRow<None>, filterRow<Sub>, filterRow<Up>, filterRow<Average>, filterRow<Paeth> };
+
+// Writes rows [begin, end) of `canvas` as filter byte + filtered bytes into `out`.
+void filterRows(const Canvas& canvas, std::size_t begin, std::size_t end, bool adaptive,
+                const std::uint8_t* zeros, std::uint8_t* scratch, std::uint8_t* out)
+{
+    const std::size_t stride = canvas.stride();
+
+    for (std::size_t y = begin; y < end; ++y, out += stride + 1) {
+        const std::uint8_t
+                *row = canvas.data() + y * stride,
+                *prior = (y > 0) ? row - stride : zeros;
+
+        if (!adaptive) {
+            out[0] = None;
+            std::memcpy(out + 1, row, stride);
+            continue;
+        }
+
+        unsigned best = None;
+        std::size_t bestSum = static_cast<std::size_t>(-1);
+        for (unsigned f = None; f <= Paeth; ++f) {
+            const std::size_t sum = FILTERS[f](row, prior, stride, scratch + f * stride);
+            if (sum < bestSum) {
+                best = f;
+                bestSum = sum;
+            }
+        }
+        out[0] = static_cast<std::uint8_t>(best);
+        std::memcpy(out + 1, scratch + best * stride, stride);
+    }
+}
+
+struct Chunk {
+    std::size_t       begin, size; // bytes of the filtered image
+    std::vector<char> out;
+    uLong             adler;
+    bool              ok;
+};
+
+// Raw deflate of one chunk, primed with the window preceding it; all but the
+// last chunk end on a byte boundary (sync flush) so the outputs concatenate.
+void deflateChunk(const std::uint8_t* data, Chunk& chunk, int level, bool last)
+{
+    chunk.ok = false;
+    chunk.adler = adler32(adler32(0, Z_NULL, 0), data + chunk.begin, static_cast<uInt>(chunk.size));
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) return;
+
+    const std::size_t dictionary = std::min(chunk.begin, WINDOW);
+    if (dictionary > 0) deflateSetDictionary(&zs, data + chunk.begin - dictionary, static_cast<uInt>(dictionary));
+
+    chunk.out.resize(deflateBound(&zs, static_cast<uLong>(chunk.size)) + 64);
+    zs.next_in  = const_cast<Bytef*>(data + chunk.begin);
+    zs.avail_in = static_cast<uInt>(chunk.size);
+
+    const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+    for (;;) {
+        zs.next_out  = reinterpret_cast<Bytef*>(chunk.out.data()) + zs.total_out;
+        zs.avail_out = static_cast<uInt>(chunk.out.size() - zs.total_out);
+
+        const int status = deflate(&zs, flush);
+        if (status == Z_STREAM_ERROR) break;
+        if (last ? (status == Z_STREAM_END) : (zs.avail_in == 0 && zs.avail_out > 0)) {
+            chunk.ok = true;
+            break;
+        }
+        if (zs.avail_out == 0) chunk.out.resize(2 * chunk.out.size());
+    }
+
+    chunk.out.resize(zs.total_out);
+    deflateEnd(&zs);
+}
+
+void putU32(char* out, std::uint32_t v)
+{
+    out[0] = static_cast<char>(v >> 24);
+    out[1] = static_cast<char>(v >> 16);
+    out[2] = static_cast<char>(v >> 8);
+    out[3] = static_cast<char>(v);
+}
+
+// Writes a PNG chunk whose data is prefix + body + suffix.
+void writeChunk(Sink& sink, const char* type,
+                const char* prefix, std::size_t prefixSize,
+                const char* body,   std::size_t bodySize,
+                const char* suffix, std::size_t suffixSize)
+{
+    char header[8];
+    putU32(header, static_cast<std::uint32_t>(prefixSize + bodySize + suffixSize));
+    std::memcpy(header + 4, type, 4);
+
+    const char*       pieces[4] = { type, prefix, body, suffix };
+    const std::size_t sizes[4] = { 4, prefixSize, bodySize, suffixSize };
+
+    uLong crc = crc32(0, Z_NULL, 0);
+    for (int i = 0; i < 4; ++i) {
+        if (sizes[i] > 0) crc = crc32(crc, reinterpret_cast<const Bytef*>(pieces[i]), static_cast<uInt>(sizes[i]));
+    }
+
+    char trailer[4];
+    putU32(trailer, static_cast<std::uint32_t>(crc));
+
+    sink.write(header, 8);
+    for (int i = 1; i < 4; ++i) {
+        if (sizes[i] > 0) sink.write(pieces[i], sizes[i]);
+    }
+    sink.write(trailer, 4);
+}
+
+} // namespace
+
+void encodePng(const Canvas& canvas, Sink& sink, const PngOptions& options)
+{
+    const std::size_t
+            width = canvas.width(),
+            height = canvas.height(),
+            stride = canvas.stride(),
+            line = stride + 1;
+
+    if (width == 0 || height == 0) throw std::runtime_error("cannot encode an empty canvas as PNG");
+
+    const int level = std::max(0, std::min(options.level, 9));
+    const std::size_t
+            chunkRows = (options.chunkRows > 0) ? options.chunkRows : std::max<std::size_t>(1, CHUNK_BYTES / line),
+            chunks = (height + chunkRows - 1) / chunkRows;
+    const unsigned threads = static_cast<unsigned>( std::min<std::size_t>(detail::resolveThreads(options.threads), chunks) );
+
+    // Filter, then deflate, chunk by chunk on every thread.
+    std::vector<std::uint8_t> filtered(height * line), zeros(stride, 0);
+    std::vector<Chunk> parts(chunks);
+    for (std::size_t k = 0; k < chunks; ++k) {
+        parts[k].begin = k * chunkRows * line;
+        parts[k].size = (std::min(height, (k + 1) * chunkRows) - k * chunkRows) * line;
+    }
+
+    std::atomic<std::size_t> next( 0 );
+    detail::parallelFor(threads, [&](unsigned) {
+        std::vector<std::uint8_t> scratch(5 * stride + 16);
+        for (std::size_t k = next++; k < chunks; k = next++) {
+            filterRows(canvas, k * chunkRows, std::min(height, (k + 1) * chunkRows), level > 0,
+                       zeros.data(), scratch.data(), filtered.data() + parts[k].begin);
+        }
+    });
+
+    next = 0;
+    detail::parallelFor(threads, [&](unsigned) {
+        for (std::size_t k = next++; k < chunks; k = next++) {
+            deflateChunk(filtered.data(), parts[k], level, k + 1 == chunks);
+        }
+    });
+
+    uLong adler = adler32(0, Z_NULL, 0);
+    for (const Chunk& part : parts) {
+        if (!part.ok) throw std::runtime_error("zlib deflate failed");
+        adler = adler32_combine(adler, part.adler, static_cast<z_off_t>(part.size));
+    }
+
+    // Signature and header.
+    sink.write("\x89PNG\r\n\x1a\n", 8);
+
+    char ihdr[13];
+    putU32(ihdr, static_cast<std::uint32_t>(width));
+    putU32(ihdr + 4, static_cast<std::uint32_t>(height));
+    ihdr[8]  = 8; // bit depth
+    ihdr[9]  = 6; // RGBA
+    ihdr[10] = 0; // deflate
+    ihdr[11] = 0; // adaptive filtering
+    ihdr[12] = 0; // no interlace
+    writeChunk(sink, "IHDR", ihdr, sizeof(ihdr), nullptr, 0, nullptr, 0);
+
+    // One IDAT per chunk: the zlib header goes before the first, the Adler-32 after the last.
+    const int levelFlags = (level < 2) ? 0 : (level < 6) ? 1 : (level == 6) ? 2 : 3;
+    char zlibHeader[2] = { 0x78, static_cast<char>(levelFlags << 6) };
+    zlibHeader[1] = static_cast<char>(zlibHeader[1] + (31 - ((0x78 << 8) | (levelFlags << 6)) % 31) % 31); // FCHECK
+
+    char zlibTrailer[4];
+    putU32(zlibTrailer, static_cast<std::uint32_t>(adler));
+
+    for (std::size_t k = 0; k < chunks; ++k) {
+        writeChunk(sink, "IDAT",
+                   zlibHeader, (k == 0) ? 2 : 0,
+                   parts[k].out.data(), parts[k].out.size(),
+                   zlibTrailer, (k + 1 == chunks) ? 4 : 0);
+    }
+
+    writeChunk(sink, "IEND", nullptr, 0, nullptr, 0, nullptr, 0);
+}
+
+} // namespace d3_path
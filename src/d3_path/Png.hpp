@@ -0,0 +1,49 @@
+#ifndef D3__PATH__PNG_HPP
+#define D3__PATH__PNG_HPP
+
+#include "d3_path/Canvas.hpp"
+#include "d3_path/Sink.hpp"
+
+namespace d3_path {
+
+struct PngOptions
+{
+    /**
+     * zlib compression level, 0 (store) … 9.
+     */
+    int level;
+
+    /**
+     * Number of worker threads; 0 means one per core.
+     */
+    unsigned threads;
+
+    /**
+     * Rows per independently deflated chunk; 0 picks about 256 KiB of pixel data.
+     */
+    std::size_t chunkRows;
+
+    PngOptions()
+        : level( 6 )
+        , threads( 0 )
+        , chunkRows( 0 )
+    { }
+};
+
+/**
+ * Encodes `canvas` as an 8-bit RGBA PNG.
+ *
+ * Every row gets the filter (None, Sub, Up, Average, Paeth) minimizing the
+ * sum of its absolute filtered bytes, computed 16 bytes at a time with SSE2
+ * when available. Rows are then deflated in chunks on parallel threads, each
+ * chunk primed with the 32 KiB preceding it and ended by a sync flush, so the
+ * chunks join into one zlib stream (as pigz does); each chunk goes to the
+ * sink as its own IDAT.
+ *
+ * Throws std::runtime_error for an empty canvas or a zlib failure.
+ */
+void encodePng(const Canvas& canvas, Sink& sink, const PngOptions& options = PngOptions());
+
+} // namespace d3_path
+
+#endif // D3__PATH__PNG_HPP
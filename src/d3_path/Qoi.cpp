@@ -0,0 +1,211 @@
+#include "d3_path/Qoi.hpp"
+
+#include <stdexcept> // for std::runtime_error()
+#include <cstring>   // for std::memcmp(), std::memcpy()
+#include <cstdint>   // for std::uint8_t, std::uint32_t
+
+namespace d3_path {
+
+namespace {
+
+const std::uint8_t
+        QOI_OP_INDEX = 0x00, // 00xxxxxx
+        QOI_OP_DIFF  = 0x40, // 01xxxxxx
+        QOI_OP_LUMA  = 0x80, // 10xxxxxx
+        QOI_OP_RUN   = 0xc0, // 11xxxxxx
+        QOI_OP_RGB   = 0xfe,
+        QOI_OP_RGBA  = 0xff,
+        QOI_MASK_2   = 0xc0;
+
+const std::size_t
+        HEADER_SIZE = 14,
+        BUFFER_SIZE = 1 << 16;
+
+const char END_MARKER[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+struct Pixel {
+    std::uint8_t r, g, b, a;
+
+    bool operator==(const Pixel& other) const {
+        return this->r == other.r && this->g == other.g && this->b == other.b && this->a == other.a;
+    }
+    bool operator!=(const Pixel& other) const { return !(*this == other); }
+
+    unsigned hash() const { return (this->r * 3u + this->g * 5u + this->b * 7u + this->a * 11u) % 64; }
+};
+
+void putU32(char* out, std::uint32_t v)
+{
+    out[0] = static_cast<char>(v >> 24);
+    out[1] = static_cast<char>(v >> 16);
+    out[2] = static_cast<char>(v >> 8);
+    out[3] = static_cast<char>(v);
+}
+
+std::uint32_t getU32(const std::uint8_t* in)
+{
+    return (std::uint32_t(in[0]) << 24) | (std::uint32_t(in[1]) << 16) | (std::uint32_t(in[2]) << 8) | in[3];
+}
+
+} // namespace
+
+void encodeQoi(const Canvas& canvas, Sink& sink)
+{
+    char header[HEADER_SIZE] = { 'q', 'o', 'i', 'f' };
+    putU32(header + 4, static_cast<std::uint32_t>(canvas.width()));
+    putU32(header + 8, static_cast<std::uint32_t>(canvas.height()));
+    header[12] = 4; // channels
+    header[13] = 0; // sRGB with linear alpha
+    sink.write(header, HEADER_SIZE);
+
+    // Staging buffer, handed to the sink whenever the next pixel might not fit:
+    // at most 6 bytes, a pending run then an RGBA op.
+    char buffer[BUFFER_SIZE];
+    std::size_t used = 0;
+
+    Pixel index[64] = {};
+    Pixel previous = { 0, 0, 0, 255 };
+    unsigned run = 0;
+
+    const std::uint8_t* p = canvas.data();
+    const std::size_t count = canvas.width() * canvas.height();
+
+    for (std::size_t i = 0; i < count; ++i, p += 4) {
+        if (used + 6 > BUFFER_SIZE) {
+            sink.write(buffer, used);
+            used = 0;
+        }
+
+        const Pixel pixel = { p[0], p[1], p[2], p[3] };
+
+        if (pixel == previous) {
+            if (++run == 62) {
+                buffer[used++] = static_cast<char>(QOI_OP_RUN | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0) {
+            buffer[used++] = static_cast<char>(QOI_OP_RUN | (run - 1));
+            run = 0;
+        }
+
+        const unsigned h = pixel.hash();
+        if (index[h] == pixel) {
+            buffer[used++] = static_cast<char>(QOI_OP_INDEX | h);
+        }
+        else {
+            index[h] = pixel;
+
+            if (pixel.a == previous.a) {
+                const signed char
+                        dr = static_cast<signed char>(pixel.r - previous.r),
+                        dg = static_cast<signed char>(pixel.g - previous.g),
+                        db = static_cast<signed char>(pixel.b - previous.b),
+                        drg = static_cast<signed char>(dr - dg),
+                        dbg = static_cast<signed char>(db - dg);
+
+                if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2) {
+                    buffer[used++] = static_cast<char>(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                }
+                else if (drg > -9 && drg < 8 && dg > -33 && dg < 32 && dbg > -9 && dbg < 8) {
+                    buffer[used++] = static_cast<char>(QOI_OP_LUMA | (dg + 32));
+                    buffer[used++] = static_cast<char>((drg + 8) << 4 | (dbg + 8));
+                }
+                else {
+                    buffer[used++] = static_cast<char>(QOI_OP_RGB);
+                    buffer[used++] = static_cast<char>(pixel.r);
+                    buffer[used++] = static_cast<char>(pixel.g);
+                    buffer[used++] = static_cast<char>(pixel.b);
+                }
+            }
+            else {
+                buffer[used++] = static_cast<char>(QOI_OP_RGBA);
+                buffer[used++] = static_cast<char>(pixel.r);
+                buffer[used++] = static_cast<char>(pixel.g);
+                buffer[used++] = static_cast<char>(pixel.b);
+                buffer[used++] = static_cast<char>(pixel.a);
+            }
+        }
+
+        previous = pixel;
+    }
+
+    if (run > 0) buffer[used++] = static_cast<char>(QOI_OP_RUN | (run - 1));
+
+    sink.write(buffer, used);
+    sink.write(END_MARKER, sizeof(END_MARKER));
+}
+
+Canvas decodeQoi(const char* data, std::size_t size)
+{
+    const std::uint8_t* in = reinterpret_cast<const std::uint8_t*>(data);
+
+    if (size < HEADER_SIZE + sizeof(END_MARKER) || std::memcmp(in, "qoif", 4) != 0) {
+        throw std::runtime_error("not a QOI image");
+    }
+
+    const std::size_t
+            width = getU32(in + 4),
+            height = getU32(in + 8),
+            end = size - sizeof(END_MARKER);
+    const unsigned channels = in[12];
+
+    if (channels != 3 && channels != 4) throw std::runtime_error("invalid QOI channel count");
+    if (height != 0 && width > (end - HEADER_SIZE) * 62 / height) throw std::runtime_error("truncated QOI image");
+
+    Canvas canvas(width, height);
+    std::uint8_t* out = canvas.data();
+
+    Pixel index[64] = {};
+    Pixel pixel = { 0, 0, 0, 255 };
+    unsigned run = 0;
+    std::size_t pos = HEADER_SIZE;
+
+    for (std::size_t i = 0, count = width * height; i < count; ++i, out += 4) {
+        if (run > 0) {
+            --run;
+        }
+        else {
+            if (pos >= end) throw std::runtime_error("truncated QOI image");
+            const std::uint8_t b1 = in[pos++];
+
+            if (b1 == QOI_OP_RGB || b1 == QOI_OP_RGBA) {
+                const std::size_t n = (b1 == QOI_OP_RGB) ? 3 : 4;
+                if (pos + n > end) throw std::runtime_error("truncated QOI image");
+                pixel.r = in[pos++];
+                pixel.g = in[pos++];
+                pixel.b = in[pos++];
+                if (n == 4) pixel.a = in[pos++];
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+                pixel = index[b1];
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+                pixel.r += ((b1 >> 4) & 0x03) - 2;
+                pixel.g += ((b1 >> 2) & 0x03) - 2;
+                pixel.b += ( b1       & 0x03) - 2;
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+                if (pos >= end) throw std::runtime_error("truncated QOI image");
+                const std::uint8_t b2 = in[pos++];
+                const int dg = (b1 & 0x3f) - 32;
+                pixel.r += dg - 8 + ((b2 >> 4) & 0x0f);
+                pixel.g += dg;
+                pixel.b += dg - 8 + (b2 & 0x0f);
+            }
+            else {
+                run = b1 & 0x3f;
+            }
+
+            index[pixel.hash()] = pixel;
+        }
+
+        std::memcpy(out, &pixel, 4);
+    }
+
+    return canvas;
+}
+
+} // namespace d3_path
@@ -0,0 +1,23 @@
+#ifndef D3__PATH__QOI_HPP
+#define D3__PATH__QOI_HPP
+
+#include "d3_path/Canvas.hpp"
+#include "d3_path/Sink.hpp"
+
+namespace d3_path {
+
+/**
+ * Encodes `canvas` as a QOI image (https://qoiformat.org, RGBA, sRGB):
+ * a single linear pass, several times faster than PNG, for caches.
+ */
+void encodeQoi(const Canvas& canvas, Sink& sink);
+
+/**
+ * Decodes a QOI image (3 or 4 channels) into a canvas.
+ * Throws std::runtime_error on malformed input.
+ */
+Canvas decodeQoi(const char* data, std::size_t size);
+
+} // namespace d3_path
+
+#endif // D3__PATH__QOI_HPP
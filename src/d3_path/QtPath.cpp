@@ -0,0 +1,61 @@
+#include "d3_path/QtPath.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+#include <QRectF>
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+using detail::pi;
+
+void QtPath::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.moveTo(x, y);
+}
+
+void QtPath::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.lineTo(x, y);
+}
+
+void QtPath::emitQuadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.quadTo(x1, y1, x, y);
+}
+
+void QtPath::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.cubicTo(x1, y1, x2, y2, x, y);
+}
+
+void QtPath::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    // Canvas angles grow clockwise on screen, Qt's counter-clockwise.
+    const number_t degrees = 180 / pi;
+    this->_path.arcTo(QRectF(cx - r, cy - r, 2 * r, 2 * r), -a0 * degrees, -da * degrees);
+}
+
+void QtPath::emitClosePath()
+{
+    this->_path.closeSubpath();
+}
+
+void QtPath::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    // Same corners in the same order as Path: ⟨x, y⟩, ⟨x + w, y⟩, ⟨x + w, y + h⟩, ⟨x, y + h⟩.
+    this->_path.addRect(x, y, w, h);
+}
+
+void QtPath::clear()
+{
+    this->_path = QPainterPath();
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+std::string QtPath::toString() const
+{
+    return std::string();
+}
+
+} // namespace d3_path
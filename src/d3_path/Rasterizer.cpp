@@ -0,0 +1,290 @@
+#include "d3_path/Rasterizer.hpp"
+
+#include "d3_path/detail/parallel.hpp"
+
+#include <atomic>
+#include <algorithm> // for std::min(), std::max(), std::swap(), std::fill()
+#include <cmath>     // for std::floor(), std::ceil(), std::abs(), std::fmod(), std::isfinite()
+
+namespace d3_path {
+
+namespace {
+
+using number_t = PathInterface::number_t;
+
+struct Edge {
+    number_t x0, y0, x1, y1;
+    number_t xMin, xMax;
+};
+
+// Accumulates the signed area covered to the right of the segment into one
+// scanline-major buffer (font-rs style). Requires y0 < y1 within [0, h],
+// x within [0, w]; rows are `stride` ≥ w + 2 cells wide.
+void accumulate(float* acc, std::size_t stride, std::size_t h,
+                number_t x, number_t y0, number_t xEnd, number_t y1, float dir)
+{
+    const number_t dxdy = (xEnd - x) / (y1 - y0);
+    const std::size_t yEnd = std::min(h, static_cast<std::size_t>( std::ceil(y1) ));
+
+    for (std::size_t y = static_cast<std::size_t>(y0); y < yEnd; ++y) {
+        float* row = acc + y * stride;
+
+        const number_t
+                dy = std::min<number_t>(y + 1, y1) - std::max<number_t>(y, y0),
+                xNext = x + dxdy * dy,
+                xa = std::min(x, xNext),
+                xb = std::max(x, xNext),
+                xaFloor = std::floor(xa),
+                xbCeil = std::ceil(xb);
+        const float d = static_cast<float>(dy) * dir;
+        const std::size_t
+                i0 = static_cast<std::size_t>(xaFloor),
+                i1 = static_cast<std::size_t>(xbCeil);
+
+        if (i1 <= i0 + 1) {
+            // Within one pixel: split by the mean x.
+            const float m = static_cast<float>(0.5 * (x + xNext) - xaFloor);
+            row[i0]     += d - d * m;
+            row[i0 + 1] += d * m;
+        }
+        else {
+            const float
+                    s = static_cast<float>(1 / (xb - xa)),
+                    fa = static_cast<float>(xa - xaFloor),
+                    a0 = 0.5f * s * (1 - fa) * (1 - fa),
+                    fb = static_cast<float>(xb - xbCeil + 1),
+                    am = 0.5f * s * fb * fb;
+
+            row[i0] += d * a0;
+            if (i1 == i0 + 2) {
+                row[i0 + 1] += d * (1 - a0 - am);
+            }
+            else {
+                const float a1 = s * (1.5f - fa);
+                row[i0 + 1] += d * (a1 - a0);
+                for (std::size_t i = i0 + 2; i < i1 - 1; ++i) row[i] += d * s;
+                const float a2 = a1 + (i1 - i0 - 3) * s;
+                row[i1 - 1] += d * (1 - a2 - am);
+            }
+            row[i1] += d * am;
+        }
+
+        x = xNext;
+    }
+}
+
+// Clips the edge to the tile [0, w] × [0, h] (coordinates relative to it) and accumulates it.
+// Parts left of the tile are pushed onto its left border, where they still count
+// for the winding of the whole row; parts right of it don't affect the tile.
+void accumulateEdge(float* acc, std::size_t stride, std::size_t w, std::size_t h,
+                    number_t x0, number_t y0, number_t x1, number_t y1)
+{
+    float dir = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1;
+    }
+    if (y1 <= 0 || y0 >= h || y0 == y1) return;
+
+    const number_t dxdy = (x1 - x0) / (y1 - y0);
+    if (y0 < 0) {
+        x0 -= y0 * dxdy;
+        y0 = 0;
+    }
+    if (y1 > h) {
+        x1 = x0 + (h - y0) * dxdy;
+        y1 = number_t(h);
+    }
+
+    // Split where the edge crosses x = 0 and x = w.
+    number_t ys[4] = { y0, y1, y1, y1 };
+    std::size_t count = 1;
+    const number_t borders[2] = { 0, number_t(w) };
+    for (const number_t border : borders) {
+        if ((x0 < border) != (x1 < border) && x0 != x1) {
+            const number_t y = y0 + (border - x0) / dxdy;
+            if (y > y0 && y < y1) ys[count++] = y;
+        }
+    }
+    ys[count++] = y1;
+    if (count == 4 && ys[1] > ys[2]) std::swap(ys[1], ys[2]);
+
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        const number_t ya = ys[i], yb = ys[i + 1];
+        if (!(yb > ya)) continue;
+
+        const number_t mid = x0 + ((ya + yb) / 2 - y0) * dxdy;
+        if (mid >= w) continue;
+
+        number_t
+                xa = x0 + (ya - y0) * dxdy,
+                xb = x0 + (yb - y0) * dxdy;
+        if (mid <= 0) {
+            xa = xb = 0;
+        }
+        else {
+            xa = std::min<number_t>(std::max<number_t>(xa, 0), w);
+            xb = std::min<number_t>(std::max<number_t>(xb, 0), w);
+        }
+        accumulate(acc, stride, h, xa, ya, xb, yb, dir);
+    }
+}
+
+} // namespace
+
+Rasterizer::Rasterizer(PathInterface::number_t tolerance)
+    : PathFlattener( tolerance )
+    , _threads( 0 )
+    , _tileSize( 64 )
+{ }
+
+void Rasterizer::fill(Canvas& canvas, Color color, FillRule rule) const
+{
+    const std::size_t
+            width  = canvas.width(),
+            height = canvas.height(),
+            tile   = std::max<std::size_t>(this->_tileSize, 1);
+
+    // Edges of every contour, implicitly closed; horizontal ones cover nothing.
+    std::vector<Edge> edges;
+    number_t
+            xMin = width, xMax = 0,
+            yMin = height, yMax = 0;
+
+    for (const Contour& contour : this->_contours) {
+        if (contour.size() < 2) continue;
+
+        for (std::size_t i = contour.begin; i < contour.end; ++i) {
+            const Point
+                    a = this->_points[i],
+                    b = this->_points[(i + 1 < contour.end) ? i + 1 : contour.begin];
+
+            if (a.y == b.y) continue;
+            if (!std::isfinite(a.x) || !std::isfinite(a.y) || !std::isfinite(b.x) || !std::isfinite(b.y)) continue;
+
+            const Edge edge = { a.x, a.y, b.x, b.y, std::min(a.x, b.x), std::max(a.x, b.x) };
+            edges.push_back(edge);
+
+            xMin = std::min(xMin, edge.xMin);
+            xMax = std::max(xMax, edge.xMax);
+            yMin = std::min(yMin, std::min(a.y, b.y));
+            yMax = std::max(yMax, std::max(a.y, b.y));
+        }
+    }
+    if (edges.empty()) return;
+
+    // Tiles touching the bounds of the path (within the canvas).
+    const auto tileIndex = [tile](number_t v, std::size_t limit, bool up) {
+        if (!(v > 0)) return std::size_t(0);
+        if (v >= limit) v = number_t(limit);
+        return static_cast<std::size_t>( up ? std::ceil(v / tile) : std::floor(v / tile) );
+    };
+    const std::size_t
+            tx0 = tileIndex(xMin, width,  false),
+            tx1 = tileIndex(xMax, width,  true),
+            ty0 = tileIndex(yMin, height, false),
+            ty1 = tileIndex(yMax, height, true);
+    if (tx0 >= tx1 || ty0 >= ty1) return;
+
+    const std::size_t
+            columns = tx1 - tx0,
+            rows = ty1 - ty0;
+
+    // Bin every edge into the tiles it overlaps. For the tiles entirely to its
+    // right, an edge only shifts the winding number of the rows it crosses:
+    // that goes into their backdrop - the winding entering the tile from the left.
+    const std::size_t tiles = columns * rows;
+    std::vector<std::vector<std::size_t>> bins(tiles);
+    std::vector<float> backdrops(tiles * tile, 0.0f);
+
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const Edge& edge = edges[i];
+        const float dir = (edge.y0 < edge.y1) ? 1.0f : -1.0f;
+        const number_t
+                top    = std::min(edge.y0, edge.y1),
+                bottom = std::max(edge.y0, edge.y1);
+        const std::size_t
+                r0 = std::max(tileIndex(top,    height, false), ty0),
+                r1 = std::min(tileIndex(bottom, height, true),  ty1),
+                c0 = std::max(tileIndex(edge.xMin, width, false), tx0),
+                c1 = std::min(tileIndex(edge.xMax, width, true),  tx1); // first column right of the edge
+
+        for (std::size_t r = r0; r < r1; ++r) {
+            for (std::size_t c = c0; c < c1; ++c) bins[(r - ty0) * columns + (c - tx0)].push_back(i);
+
+            if (c1 == tx1) continue;
+
+            float* backdrop = backdrops.data() + ((r - ty0) * columns + (c1 - tx0)) * tile;
+            const std::size_t
+                    y0 = r * tile,
+                    yA = static_cast<std::size_t>( std::max<number_t>(top, y0) ),
+                    yB = std::min(static_cast<std::size_t>( std::ceil(bottom) ), std::min(y0 + tile, height));
+            for (std::size_t y = yA; y < yB; ++y) {
+                backdrop[y - y0] += dir * static_cast<float>(std::min<number_t>(y + 1, bottom) - std::max<number_t>(y, top));
+            }
+        }
+    }
+
+    // Accumulate the backdrops along each tile row.
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 1; c < columns; ++c) {
+            float* backdrop = backdrops.data() + (r * columns + c) * tile;
+            const float* left = backdrop - tile;
+            for (std::size_t y = 0; y < tile; ++y) backdrop[y] += left[y];
+        }
+    }
+
+    const unsigned threads = static_cast<unsigned>( std::min<std::size_t>(detail::resolveThreads(this->_threads), tiles) );
+    std::atomic<std::size_t> next( 0 );
+
+    detail::parallelFor(threads, [&](unsigned) {
+        const std::size_t stride = tile + 2;
+        std::vector<float> acc(stride * tile), coverage(tile);
+
+        for (std::size_t t = next++; t < tiles; t = next++) {
+            const std::size_t
+                    x0 = (tx0 + t % columns) * tile,
+                    y0 = (ty0 + t / columns) * tile,
+                    w = std::min(tile, width - x0),
+                    h = std::min(tile, height - y0);
+
+            const std::vector<std::size_t>& bin = bins[t];
+            const float* backdrop = backdrops.data() + t * tile;
+
+            bool empty = bin.empty();
+            for (std::size_t y = 0; empty && y < h; ++y) empty = (std::abs(backdrop[y]) < 1.0f / 512);
+            if (empty) continue;
+
+            std::fill(acc.begin(), acc.begin() + stride * h, 0.0f);
+            for (const std::size_t i : bin) {
+                const Edge& edge = edges[i];
+                accumulateEdge(acc.data(), stride, w, h,
+                               edge.x0 - x0, edge.y0 - y0, edge.x1 - x0, edge.y1 - y0);
+            }
+
+            for (std::size_t y = 0; y < h; ++y) {
+                const float* cells = acc.data() + y * stride;
+                float winding = backdrop[y];
+                bool any = false;
+                for (std::size_t x = 0; x < w; ++x) {
+                    winding += cells[x];
+                    float c = std::abs(winding);
+                    if (rule == FillRule::NonZero) {
+                        c = std::min(c, 1.0f);
+                    }
+                    else {
+                        c = std::fmod(c, 2.0f);
+                        if (c > 1) c = 2 - c;
+                    }
+                    if (c < 1.0f / 512) c = 0; // rounding residue of the running sum
+                    coverage[x] = c;
+                    any = any || (c > 0);
+                }
+                if (any) canvas.blendSpan(x0, y0 + y, coverage.data(), w, color);
+            }
+        }
+    });
+}
+
+} // namespace d3_path
@@ -0,0 +1,48 @@
+#ifndef D3__PATH__RASTERIZER_HPP
+#define D3__PATH__RASTERIZER_HPP
+
+#include "d3_path/PathFlattener.hpp"
+#include "d3_path/FillRule.hpp"
+#include "d3_path/Canvas.hpp"
+
+namespace d3_path {
+
+/**
+ * A PathInterface that fills the path it receives into a Canvas, with
+ * anti-aliasing by exact area coverage: each edge adds its signed area to
+ * an accumulation buffer, whose running sum along a row is the winding
+ * number of every pixel, fractional at the edges.
+ *
+ * The image is cut into tiles of tileSize × tileSize pixels; only the tiles
+ * touching the path bounds are rendered, by `threads` worker threads, each
+ * with its own accumulation buffer. Drawing works like a canvas context:
+ * build the path, fill() it (as often as needed), then clear() it.
+ */
+class Rasterizer final : public PathFlattener
+{
+    unsigned    _threads;
+    std::size_t _tileSize;
+
+public:
+
+    /**
+     * `tolerance` is the flattening tolerance of curves, in pixels.
+     */
+    Rasterizer(number_t tolerance = 0.2);
+
+    /**
+     * Number of worker threads; 0 (the default) means one per core.
+     */
+    void setThreads(unsigned threads) { this->_threads = threads; }
+
+    void setTileSize(std::size_t tileSize) { this->_tileSize = tileSize; }
+
+    /**
+     * Fills the current path into `canvas` with `color`, every contour implicitly closed.
+     */
+    void fill(Canvas& canvas, Color color, FillRule rule = FillRule::NonZero) const;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__RASTERIZER_HPP
@@ -0,0 +1,142 @@
+#include "d3_path/RecordedPath.hpp"
+
+#include "d3_path/Path.hpp"
+
+namespace d3_path {
+
+std::size_t RecordedPath::arity(Command command)
+{
+    switch (command) {
+    case Command::MoveTo:           return 2;
+    case Command::ClosePath:        return 0;
+    case Command::LineTo:           return 2;
+    case Command::QuadraticCurveTo: return 4;
+    case Command::BezierCurveTo:    return 6;
+    case Command::ArcTo:            return 5;
+    case Command::Arc:              return 6;
+    case Command::Rect:             return 4;
+    }
+    return 0;
+}
+
+std::size_t RecordedPath::points(Command command)
+{
+    switch (command) {
+    case Command::MoveTo:           return 1;
+    case Command::ClosePath:        return 0;
+    case Command::LineTo:           return 1;
+    case Command::QuadraticCurveTo: return 2;
+    case Command::BezierCurveTo:    return 3;
+    case Command::ArcTo:            return 2;
+    case Command::Arc:              return 1;
+    case Command::Rect:             return 1;
+    }
+    return 0;
+}
+
+RecordedPath::RecordedPath(Arena& arena)
+    : _commands( ArenaAllocator<Command>(arena) )
+    , _numbers( ArenaAllocator<number_t>(arena) )
+{ }
+
+void RecordedPath::replay(Command command, const number_t* a, PathInterface& path)
+{
+    switch (command) {
+    case Command::MoveTo:           path.moveTo(a[0], a[1]); break;
+    case Command::ClosePath:        path.closePath(); break;
+    case Command::LineTo:           path.lineTo(a[0], a[1]); break;
+    case Command::QuadraticCurveTo: path.quadraticCurveTo(a[0], a[1], a[2], a[3]); break;
+    case Command::BezierCurveTo:    path.bezierCurveTo(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+    case Command::ArcTo:            path.arcTo(a[0], a[1], a[2], a[3], a[4]); break;
+    case Command::Arc:              path.arc(a[0], a[1], a[2], a[3], a[4], a[5] != 0); break;
+    case Command::Rect:             path.rect(a[0], a[1], a[2], a[3]); break;
+    }
+}
+
+void RecordedPath::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->push(Command::MoveTo);
+    this->_numbers.insert(this->_numbers.end(), { x, y });
+}
+
+void RecordedPath::closePath()
+{
+    this->push(Command::ClosePath);
+}
+
+void RecordedPath::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->push(Command::LineTo);
+    this->_numbers.insert(this->_numbers.end(), { x, y });
+}
+
+void RecordedPath::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->push(Command::QuadraticCurveTo);
+    this->_numbers.insert(this->_numbers.end(), { x1, y1, x, y });
+}
+
+void RecordedPath::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->push(Command::BezierCurveTo);
+    this->_numbers.insert(this->_numbers.end(), { x1, y1, x2, y2, x, y });
+}
+
+void RecordedPath::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    this->push(Command::ArcTo);
+    this->_numbers.insert(this->_numbers.end(), { x1, y1, x2, y2, r });
+}
+
+void RecordedPath::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    this->push(Command::Arc);
+    this->_numbers.insert(this->_numbers.end(), { x, y, r, a0, a1, number_t(ccw ? 1 : 0) });
+}
+
+void RecordedPath::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->push(Command::Rect);
+    this->_numbers.insert(this->_numbers.end(), { x, y, w, h });
+}
+
+std::string RecordedPath::toString() const
+{
+    Path path;
+    this->replay(path);
+    return path.toString();
+}
+
+void RecordedPath::replay(PathInterface& path) const
+{
+    const number_t* args = this->_numbers.data();
+    for (const Command command : this->_commands) {
+        replay(command, args, path);
+        args += arity(command);
+    }
+}
+
+void RecordedPath::replay(PathInterface& path, number_t dx, number_t dy) const
+{
+    number_t moved[6];
+
+    const number_t* args = this->_numbers.data();
+    for (const Command command : this->_commands) {
+        const std::size_t n = arity(command), p = points(command);
+        for (std::size_t i = 0; i < n; ++i) moved[i] = args[i];
+        for (std::size_t i = 0; i < p; ++i) {
+            moved[2 * i]     += dx;
+            moved[2 * i + 1] += dy;
+        }
+        replay(command, moved, path);
+        args += n;
+    }
+}
+
+void RecordedPath::clear()
+{
+    this->_commands.clear();
+    this->_numbers.clear();
+}
+
+} // namespace d3_path
@@ -0,0 +1,111 @@
+#ifndef D3__PATH__RECORDED_PATH_HPP
+#define D3__PATH__RECORDED_PATH_HPP
+
+#include "d3_path/PathInterface.hpp"
+#include "d3_path/Arena.hpp"
+
+#include <vector>
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * A PathInterface that records the exact call sequence, as one opcode per
+ * call plus its arguments in a flat number array, to be replayed later into
+ * any other PathInterface.
+ */
+class RecordedPath final : public PathInterface
+{
+public:
+
+    enum class Command : unsigned char {
+        MoveTo,           // x, y
+        ClosePath,        //
+        LineTo,           // x, y
+        QuadraticCurveTo, // x1, y1, x, y
+        BezierCurveTo,    // x1, y1, x2, y2, x, y
+        ArcTo,            // x1, y1, x2, y2, r
+        Arc,              // x, y, r, a0, a1, ccw (0 or 1)
+        Rect,             // x, y, w, h
+    };
+
+    /**
+     * Number of arguments of `command`.
+     */
+    static std::size_t arity(Command command);
+
+    /**
+     * Number of leading ⟨x, y⟩ pairs among the arguments of `command`
+     * (the ones that move with a translation).
+     */
+    static std::size_t points(Command command);
+
+    /**
+     * Calls the method corresponding to `command` on `path` with `args`.
+     */
+    static void replay(Command command, const number_t* args, PathInterface& path);
+
+    using Commands = std::vector<Command, ArenaAllocator<Command>>;
+    using Numbers  = std::vector<number_t, ArenaAllocator<number_t>>;
+
+private:
+
+    Commands _commands;
+    Numbers  _numbers;
+
+    void push(Command command) { this->_commands.push_back(command); }
+
+public:
+
+    RecordedPath() = default;
+
+    /**
+     * Records into memory from `arena`; the path must not outlive it.
+     */
+    explicit RecordedPath(Arena& arena);
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t r) override;
+
+    void arc(number_t x, number_t y, number_t r, number_t a0, number_t a1, bool ccw = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+
+    /**
+     * Returns the string a Path would produce for the recorded calls.
+     */
+    std::string toString() const override;
+
+    /**
+     * Replays every recorded call into `path`.
+     */
+    void replay(PathInterface& path) const;
+
+    /**
+     * Replays every recorded call into `path`, translated by ⟨dx, dy⟩.
+     */
+    void replay(PathInterface& path, number_t dx, number_t dy) const;
+
+    const Commands& commands() const { return this->_commands; }
+    const Numbers&  numbers() const  { return this->_numbers; }
+
+    bool empty() const { return this->_commands.empty(); }
+
+    /**
+     * Forgets the recorded calls, keeping the allocated capacity.
+     */
+    void clear();
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__RECORDED_PATH_HPP
@@ -0,0 +1,192 @@
+#include "d3_path/RopeBuffer.hpp"
+
+#include <new>       // for std::bad_alloc
+#include <cstdlib>   // for std::malloc(), std::free()
+#include <cstring>   // for std::memcpy(), std::strerror()
+#include <utility>   // for std::swap()
+#include <algorithm> // for std::min()
+
+#ifdef D3_PATH_HAS_POSIX
+#  include <cerrno>    // for errno, EINTR
+#  include <climits>   // for IOV_MAX
+#  include <stdexcept> // for std::runtime_error()
+#  include <unistd.h>  // for ssize_t
+#  ifndef IOV_MAX
+#    define IOV_MAX 1024
+#  endif
+#endif
+
+namespace d3_path {
+
+const std::size_t ChunkPool::DEFAULT_CHUNK_SIZE;
+
+ChunkPool::ChunkPool(std::size_t chunkSize, std::size_t maxFree)
+    : _chunkSize( chunkSize )
+    , _maxFree( maxFree )
+{ }
+
+ChunkPool::~ChunkPool()
+{
+    for (char* chunk : this->_free) std::free(chunk);
+}
+
+ChunkPool& ChunkPool::local()
+{
+    thread_local ChunkPool pool;
+    return pool;
+}
+
+char* ChunkPool::take()
+{
+    if (this->_free.empty()) {
+        char* chunk = static_cast<char*>(std::malloc(this->_chunkSize));
+        if (chunk == nullptr) throw std::bad_alloc();
+        return chunk;
+    }
+    char* chunk = this->_free.back();
+    this->_free.pop_back();
+    return chunk;
+}
+
+void ChunkPool::give(char* chunk)
+{
+    if (this->_free.size() < this->_maxFree) this->_free.push_back(chunk);
+    else std::free(chunk);
+}
+
+RopeBuffer::RopeBuffer(ChunkPool* pool)
+    : _pool( pool )
+    , _size( 0 )
+    , _chunkSize( pool ? pool->chunkSize() : ChunkPool::DEFAULT_CHUNK_SIZE )
+{ }
+
+RopeBuffer::RopeBuffer(const RopeBuffer& other)
+    : _pool( other._pool )
+    , _size( 0 )
+    , _chunkSize( other._chunkSize )
+{
+    this->append(other);
+}
+
+RopeBuffer::RopeBuffer(RopeBuffer&& other)
+    : _pool( other._pool )
+    , _chunks( std::move(other._chunks) )
+    , _size( other._size )
+    , _chunkSize( other._chunkSize )
+{
+    other._chunks.clear();
+    other._size = 0;
+}
+
+RopeBuffer& RopeBuffer::operator=(RopeBuffer other)
+{
+    std::swap(this->_pool, other._pool);
+    std::swap(this->_chunks, other._chunks);
+    std::swap(this->_size, other._size);
+    std::swap(this->_chunkSize, other._chunkSize);
+    return *this;
+}
+
+RopeBuffer::~RopeBuffer()
+{
+    if (this->_chunks.empty()) return;
+
+    ChunkPool& pool = this->pool();
+    for (char* chunk : this->_chunks) pool.give(chunk);
+}
+
+void RopeBuffer::grow()
+{
+    this->_chunks.push_back(this->pool().take());
+}
+
+void RopeBuffer::append(const char* data, std::size_t size)
+{
+    while (size > 0) {
+        const std::size_t
+                chunk = this->_size / this->_chunkSize,
+                offset = this->_size % this->_chunkSize,
+                n = std::min(size, this->_chunkSize - offset);
+        if (chunk == this->_chunks.size()) this->grow();
+
+        std::memcpy(this->_chunks[chunk] + offset, data, n);
+        this->_size += n;
+        data += n;
+        size -= n;
+    }
+}
+
+void RopeBuffer::append(const RopeBuffer& other)
+{
+    const std::size_t size = other._size;
+    for (std::size_t i = 0, offset = 0; offset < size; ++i, offset += other._chunkSize) {
+        this->append(other._chunks[i], std::min(other._chunkSize, size - offset));
+    }
+}
+
+void RopeBuffer::shrink_to_fit()
+{
+    const std::size_t used = (this->_size + this->_chunkSize - 1) / this->_chunkSize;
+    if (used == this->_chunks.size()) return;
+
+    ChunkPool& pool = this->pool();
+    for (std::size_t i = used; i < this->_chunks.size(); ++i) pool.give(this->_chunks[i]);
+    this->_chunks.resize(used);
+    this->_chunks.shrink_to_fit();
+}
+
+#ifdef D3_PATH_HAS_POSIX
+std::vector<struct iovec> RopeBuffer::iovecs() const
+{
+    std::vector<struct iovec> views;
+    views.reserve(this->_chunks.size());
+    for (std::size_t i = 0, offset = 0; offset < this->_size; ++i, offset += this->_chunkSize) {
+        struct iovec view;
+        view.iov_base = this->_chunks[i];
+        view.iov_len = std::min(this->_chunkSize, this->_size - offset);
+        views.push_back(view);
+    }
+    return views;
+}
+
+void RopeBuffer::writeTo(int fd) const
+{
+    std::vector<struct iovec> views = this->iovecs();
+
+    for (std::size_t first = 0; first < views.size();) {
+        const int count = static_cast<int>(std::min<std::size_t>(views.size() - first, IOV_MAX));
+        const ssize_t written = ::writev(fd, views.data() + first, count);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("cannot write file: ") + std::strerror(errno));
+        }
+
+        // Skip what was written; a short write leaves part of a view.
+        std::size_t rest = static_cast<std::size_t>(written);
+        while (first < views.size() && rest >= views[first].iov_len) rest -= views[first++].iov_len;
+        if (rest > 0) {
+            views[first].iov_base = static_cast<char*>(views[first].iov_base) + rest;
+            views[first].iov_len -= rest;
+        }
+    }
+}
+#endif
+
+void RopeBuffer::writeTo(Sink& sink) const
+{
+    for (std::size_t i = 0, offset = 0; offset < this->_size; ++i, offset += this->_chunkSize) {
+        sink.write(this->_chunks[i], std::min(this->_chunkSize, this->_size - offset));
+    }
+}
+
+std::string RopeBuffer::str() const
+{
+    std::string out;
+    out.reserve(this->_size);
+    for (std::size_t i = 0, offset = 0; offset < this->_size; ++i, offset += this->_chunkSize) {
+        out.append(this->_chunks[i], std::min(this->_chunkSize, this->_size - offset));
+    }
+    return out;
+}
+
+} // namespace d3_path
@@ -0,0 +1,147 @@
+#ifndef D3__PATH__ROPE_BUFFER_HPP
+#define D3__PATH__ROPE_BUFFER_HPP
+
+#include "d3_path/Sink.hpp"
+
+#include <vector>
+#include <string>
+#include <cstddef>   // for std::size_t
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/uio.h> // for struct iovec
+#  define D3_PATH_HAS_POSIX 1
+#endif
+
+namespace d3_path {
+
+/**
+ * A free list of fixed-size chunks for RopeBuffer. Not synchronized: use
+ * one per thread, which is what local() gives.
+ */
+class ChunkPool
+{
+    std::vector<char*> _free;
+    std::size_t        _chunkSize;
+    std::size_t        _maxFree;
+
+public:
+
+    static const std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * Keeps at most `maxFree` returned chunks for reuse.
+     */
+    explicit ChunkPool(std::size_t chunkSize = DEFAULT_CHUNK_SIZE, std::size_t maxFree = 64);
+
+    ~ChunkPool();
+
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool& operator=(const ChunkPool&) = delete;
+
+    /**
+     * The calling thread's pool, of DEFAULT_CHUNK_SIZE chunks.
+     */
+    static ChunkPool& local();
+
+    std::size_t chunkSize() const { return this->_chunkSize; }
+
+    char* take();
+
+    void give(char* chunk);
+
+    /**
+     * Number of chunks on the free list.
+     */
+    std::size_t size() const { return this->_free.size(); }
+};
+
+/**
+ * Path data as a list of fixed-size chunks: appending never moves what is
+ * already written, so a huge path grows without the copies of a doubling
+ * string. Written out chunk by chunk (writeTo(), or iovecs() on POSIX), it
+ * never has to be contiguous; str() makes the one copy when a string is
+ * needed.
+ *
+ * A Buffer for BasicPath (see RopePath).
+ */
+class RopeBuffer
+{
+    ChunkPool*         _pool; // nullptr: the calling thread's ChunkPool::local()
+    std::vector<char*> _chunks;
+    std::size_t        _size;
+    std::size_t        _chunkSize;
+
+    ChunkPool& pool() const { return this->_pool ? *this->_pool : ChunkPool::local(); }
+
+    void grow();
+
+public:
+
+    /**
+     * Takes its chunks from `pool`, by default the calling thread's local one.
+     */
+    explicit RopeBuffer(ChunkPool* pool = nullptr);
+
+    RopeBuffer(const RopeBuffer& other);
+
+    RopeBuffer(RopeBuffer&& other);
+
+    RopeBuffer& operator=(RopeBuffer other);
+
+    ~RopeBuffer();
+
+    void append(const char* data, std::size_t size);
+
+    /**
+     * Appends `other`'s data, chunk by chunk (`other` may be this buffer).
+     */
+    void append(const RopeBuffer& other);
+
+    std::size_t size() const { return this->_size; }
+
+    bool empty() const { return this->_size == 0; }
+
+    std::size_t capacity() const { return this->_chunks.size() * this->_chunkSize; }
+
+    std::size_t chunkSize() const { return this->_chunkSize; }
+
+    /**
+     * Empties the buffer, keeping its chunks.
+     */
+    void clear() { this->_size = 0; }
+
+    /**
+     * Gives the chunks beyond the data back to the pool.
+     */
+    void shrink_to_fit();
+
+#ifdef D3_PATH_HAS_POSIX
+    /**
+     * The data as one view per chunk, for writev() / sendmsg().
+     */
+    std::vector<struct iovec> iovecs() const;
+
+    /**
+     * Writes the data to a file descriptor with writev(), in batches of
+     * IOV_MAX chunks. Throws std::runtime_error when writing fails.
+     */
+    void writeTo(int fd) const;
+#endif
+
+    /**
+     * Writes the data to `sink`, one write() per chunk.
+     */
+    void writeTo(Sink& sink) const;
+
+    std::string str() const;
+};
+
+// For BasicPath (see detail/basic_path.hpp): a RopeBuffer has no data().
+
+inline std::string bufferString(const RopeBuffer& buffer) { return buffer.str(); }
+
+inline void appendBuffer(RopeBuffer& buffer, const RopeBuffer& other) { buffer.append(other); }
+
+} // namespace d3_path
+
+#endif // D3__PATH__ROPE_BUFFER_HPP
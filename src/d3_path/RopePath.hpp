@@ -0,0 +1,19 @@
+#ifndef D3__PATH__ROPE_PATH_HPP
+#define D3__PATH__ROPE_PATH_HPP
+
+#include "d3_path/Path.hpp"
+#include "d3_path/RopeBuffer.hpp"
+
+namespace d3_path {
+
+/**
+ * A Path for huge outputs, in chunks that never move: write it out with
+ * buffer().writeTo() rather than copying it whole with toString().
+ */
+using RopePath = BasicPath<RopeBuffer>;
+
+extern template class BasicPath<RopeBuffer>;
+
+} // namespace d3_path
+
+#endif // D3__PATH__ROPE_PATH_HPP
@@ -0,0 +1,235 @@
+#include "d3_path/ShapeDictionary.hpp"
+
+#include "d3_path/Path.hpp"
+#include "d3_path/detail/to_str.hpp"
+
+#include <cmath> // for std::llround()
+
+namespace d3_path {
+
+namespace {
+
+// FNV-1a over the key values.
+std::uint64_t hashKey(const std::vector<std::int64_t>& key)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    for (const std::int64_t value : key) {
+        std::uint64_t v = static_cast<std::uint64_t>(value);
+        for (int i = 0; i < 8; ++i, v >>= 8) {
+            hash ^= (v & 0xff);
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+} // namespace
+
+ShapeDictionary::ShapeDictionary(number_t precision)
+    : _precision( precision )
+{ }
+
+ShapeDictionary::Instance ShapeDictionary::lookup() const
+{
+    using Command = RecordedPath::Command;
+
+    const RecordedPath::Commands& commands = this->_current.commands();
+    const RecordedPath::Numbers&  numbers  = this->_current.numbers();
+
+    // The first point of the subpath is its origin.
+    number_t ox = 0, oy = 0;
+    if (RecordedPath::points(commands.front()) > 0) {
+        ox = numbers[0];
+        oy = numbers[1];
+    }
+
+    // Canonical key: opcodes followed by their arguments, relative to the
+    // origin and quantized, so equal shapes compare (and hash) equal.
+    this->_key.clear();
+    std::size_t k = 0;
+    for (const Command command : commands) {
+        const std::size_t n = RecordedPath::arity(command), p = RecordedPath::points(command);
+        this->_key.push_back( static_cast<std::int64_t>(command) );
+        for (std::size_t i = 0; i < n; ++i) {
+            number_t v = numbers[k + i];
+            if (i < 2 * p) v -= (i % 2 == 0) ? ox : oy;
+            this->_key.push_back( std::llround(v / this->_precision) );
+        }
+        k += n;
+    }
+
+    std::size_t id = this->_shapes.size();
+    const auto bucket = this->_index.find( hashKey(this->_key) );
+    if (bucket != this->_index.end()) {
+        for (const std::size_t candidate : bucket->second) {
+            if (this->_shapes[candidate].key == this->_key) {
+                id = candidate;
+                break;
+            }
+        }
+    }
+
+    return Instance{id, ox, oy};
+}
+
+ShapeDictionary::Shape ShapeDictionary::makeShape() const
+{
+    using Command = RecordedPath::Command;
+
+    Shape shape;
+    shape.uses = 0;
+
+    number_t args[6];
+    std::size_t j = 0;
+    while (j < this->_key.size()) {
+        const Command command = static_cast<Command>(this->_key[j++]);
+        const std::size_t n = RecordedPath::arity(command);
+        for (std::size_t i = 0; i < n; ++i) args[i] = this->_key[j++] * this->_precision;
+        RecordedPath::replay(command, args, shape.path);
+    }
+    shape.key = this->_key;
+    return shape;
+}
+
+void ShapeDictionary::endSubpath()
+{
+    if ( this->_current.empty() ) return;
+
+    const Instance instance = this->lookup();
+
+    // New shape: rebuild it from the quantized key.
+    if (instance.shape == this->_shapes.size()) {
+        this->_shapes.push_back( this->makeShape() );
+        this->_index[ hashKey(this->_key) ].push_back(instance.shape);
+    }
+
+    this->_shapes[instance.shape].uses += 1;
+    this->_instances.push_back(instance);
+
+    this->_current.clear();
+}
+
+bool ShapeDictionary::pending(Instance& instance, Shape& fresh) const
+{
+    if ( this->_current.empty() ) return false;
+
+    instance = this->lookup();
+    if (instance.shape == this->_shapes.size()) {
+        fresh = this->makeShape();
+        fresh.uses = 1;
+    }
+    return true;
+}
+
+std::size_t ShapeDictionary::shapes() const
+{
+    Instance instance;
+    Shape fresh;
+    const bool isNew = this->pending(instance, fresh) && instance.shape == this->_shapes.size();
+    return this->_shapes.size() + (isNew ? 1 : 0);
+}
+
+std::size_t ShapeDictionary::instances() const
+{
+    return this->_instances.size() + (this->_current.empty() ? 0 : 1);
+}
+
+void ShapeDictionary::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->endSubpath();
+    this->_current.moveTo(x, y);
+}
+
+void ShapeDictionary::closePath()
+{
+    this->_current.closePath();
+}
+
+void ShapeDictionary::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_current.lineTo(x, y);
+}
+
+void ShapeDictionary::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_current.quadraticCurveTo(x1, y1, x, y);
+}
+
+void ShapeDictionary::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_current.bezierCurveTo(x1, y1, x2, y2, x, y);
+}
+
+void ShapeDictionary::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    this->_current.arcTo(x1, y1, x2, y2, r);
+}
+
+void ShapeDictionary::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    this->_current.arc(x, y, r, a0, a1, ccw);
+}
+
+void ShapeDictionary::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->endSubpath();
+    this->_current.rect(x, y, w, h);
+}
+
+std::string ShapeDictionary::toString() const
+{
+    Path path;
+    for (const Instance& instance : this->_instances) {
+        this->_shapes[instance.shape].path.replay(path, instance.x, instance.y);
+    }
+
+    Instance last;
+    Shape fresh;
+    if (this->pending(last, fresh)) {
+        const Shape& shape = (last.shape < this->_shapes.size()) ? this->_shapes[last.shape] : fresh;
+        shape.path.replay(path, last.x, last.y);
+    }
+    return path.toString();
+}
+
+std::string ShapeDictionary::toSvg(std::size_t minUses, const std::string& idPrefix) const
+{
+    // The subpath in progress counts as one more instance, of `fresh` when its shape is new.
+    Instance last;
+    Shape fresh;
+    const bool hasPending = this->pending(last, fresh);
+
+    const std::size_t none = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> ids(this->_shapes.size() + 1, none);
+    std::size_t nextId = 0;
+
+    std::string defs, body;
+
+    auto write = [&](const Instance& instance) {
+        const bool isFresh = instance.shape == this->_shapes.size();
+        const Shape& shape = isFresh ? fresh : this->_shapes[instance.shape];
+        const std::size_t uses = shape.uses + ((hasPending && !isFresh && last.shape == instance.shape) ? 1 : 0);
+
+        if (uses < minUses) {
+            Path path;
+            shape.path.replay(path, instance.x, instance.y);
+            body += "<path d=\"" + path.toString() + "\"/>";
+            return;
+        }
+
+        std::size_t& id = ids[instance.shape];
+        if (id == none) {
+            id = nextId++;
+            defs += "<path id=\"" + idPrefix + detail::to_str(id) + "\" d=\"" + shape.path.toString() + "\"/>";
+        }
+
+        body += "<use href=\"#" + idPrefix + detail::to_str(id) + "\" x=\"" + detail::to_str(instance.x) + "\" y=\"" + detail::to_str(instance.y) + "\"/>";
+    };
+
+    for (const Instance& instance : this->_instances) write(instance);
+    if (hasPending) write(last);
+
+    return defs.empty() ? body : "<defs>" + defs + "</defs>" + body;
+}
+
+} // namespace d3_path
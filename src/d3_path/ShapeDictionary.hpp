@@ -0,0 +1,98 @@
+#ifndef D3__PATH__SHAPE_DICTIONARY_HPP
+#define D3__PATH__SHAPE_DICTIONARY_HPP
+
+#include "d3_path/RecordedPath.hpp"
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint> // for std::int64_t, std::uint64_t
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * A PathInterface that detects repeated subpaths (e.g. scatter-plot markers
+ * drawn at different offsets) and serializes every distinct shape once.
+ *
+ * Each subpath - started by moveTo or rect - is recorded, translated so its
+ * first point is ⟨0, 0⟩, quantized to `precision` and hashed. toSvg() then
+ * emits the shapes as <defs> and every occurrence as a translated <use>.
+ * Queries count the subpath in progress without ending it.
+ */
+class ShapeDictionary final : public PathInterface
+{
+    struct Shape {
+        RecordedPath              path; // canonical: first point at ⟨0, 0⟩
+        std::vector<std::int64_t> key;  // opcodes and quantized numbers, for exact comparison
+        std::size_t               uses;
+    };
+
+    struct Instance {
+        std::size_t shape;
+        number_t    x, y;
+    };
+
+    number_t _precision;
+
+    RecordedPath          _current; // subpath being recorded
+    std::vector<Shape>    _shapes;
+    std::vector<Instance> _instances;
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> _index;
+    mutable std::vector<std::int64_t> _key; // scratch
+
+    // Fills _key with the current subpath's canonical key; returns its
+    // instance, whose shape is _shapes.size() when the shape is new.
+    Instance lookup() const;
+
+    // The shape rebuilt from _key.
+    Shape makeShape() const;
+
+    void endSubpath();
+
+    // The current subpath as endSubpath() would record it, without recording
+    // it: false when there is none. A new shape is built into `fresh`.
+    bool pending(Instance& instance, Shape& fresh) const;
+
+public:
+
+    ShapeDictionary(number_t precision = 1e-6);
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t r) override;
+
+    void arc(number_t x, number_t y, number_t r, number_t a0, number_t a1, bool ccw = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+
+    /**
+     * Returns the full path data, every shape expanded at its offset.
+     */
+    std::string toString() const override;
+
+    /**
+     * Returns SVG markup: a <defs> block with one <path id="{idPrefix}{n}">
+     * per shape used at least `minUses` times, followed by one
+     * <use href="#{idPrefix}{n}" x="…" y="…"/> per occurrence, in drawing
+     * order. Rarer shapes are written inline as <path d="…"/>.
+     */
+    std::string toSvg(std::size_t minUses = 2, const std::string& idPrefix = "shape") const;
+
+    /**
+     * Number of distinct shapes / of subpaths seen so far.
+     */
+    std::size_t shapes() const;
+    std::size_t instances() const;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__SHAPE_DICTIONARY_HPP
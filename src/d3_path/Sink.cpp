@@ -0,0 +1,34 @@
+#include "d3_path/Sink.hpp"
+
+#include <stdexcept> // for std::runtime_error()
+
+namespace d3_path {
+
+FileSink::FileSink(const std::string& filename)
+    : _file( std::fopen(filename.c_str(), "wb") )
+    , _owned( true )
+{
+    if (this->_file == nullptr) throw std::runtime_error("cannot open file: " + filename);
+}
+
+FileSink::FileSink(std::FILE* file)
+    : _file( file )
+    , _owned( false )
+{ }
+
+FileSink::~FileSink()
+{
+    if (this->_owned) std::fclose(this->_file);
+}
+
+void FileSink::write(const char* data, std::size_t size)
+{
+    if (std::fwrite(data, 1, size, this->_file) != size) throw std::runtime_error("cannot write file");
+}
+
+void FileSink::flush()
+{
+    if (std::fflush(this->_file) != 0) throw std::runtime_error("cannot write file");
+}
+
+} // namespace d3_path
@@ -0,0 +1,72 @@
+#ifndef D3__PATH__SINK_HPP
+#define D3__PATH__SINK_HPP
+
+#include <string>
+#include <cstdio>  // for std::FILE
+#include <cstddef> // for std::size_t
+
+namespace d3_path {
+
+/**
+ * Destination of encoded output (images, documents). Encoders hand their
+ * own buffers to write() as they fill up, so nothing is assembled twice.
+ */
+class Sink
+{
+public:
+
+    virtual ~Sink() = default;
+
+    virtual void write(const char* data, std::size_t size) = 0;
+
+    void write(const std::string& data) { this->write(data.data(), data.size()); }
+};
+
+/**
+ * Appends to a caller-owned string.
+ */
+class StringSink : public Sink
+{
+    std::string& _out;
+
+public:
+
+    explicit StringSink(std::string& out)
+        : _out( out )
+    { }
+
+    void write(const char* data, std::size_t size) override { this->_out.append(data, size); }
+
+    using Sink::write;
+};
+
+/**
+ * Writes to a stdio file: either opened (and closed) by the sink, or borrowed.
+ * Throws std::runtime_error when the file can't be opened or written.
+ */
+class FileSink : public Sink
+{
+    std::FILE* _file;
+    bool       _owned;
+
+public:
+
+    explicit FileSink(const std::string& filename);
+
+    explicit FileSink(std::FILE* file);
+
+    ~FileSink() override;
+
+    FileSink(const FileSink&) = delete;
+    FileSink& operator=(const FileSink&) = delete;
+
+    void write(const char* data, std::size_t size) override;
+
+    using Sink::write;
+
+    void flush();
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__SINK_HPP
@@ -0,0 +1,69 @@
+#include "d3_path/SkiaPath.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+#include "include/core/SkRect.h"
+
+#include <cmath> // for std::abs()
+
+namespace d3_path {
+
+using detail::NULL_NUMBER;
+using detail::pi;
+
+void SkiaPath::emitMoveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.moveTo(SkScalar(x), SkScalar(y));
+}
+
+void SkiaPath::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.lineTo(SkScalar(x), SkScalar(y));
+}
+
+void SkiaPath::emitQuadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.quadTo(SkScalar(x1), SkScalar(y1), SkScalar(x), SkScalar(y));
+}
+
+void SkiaPath::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->_path.cubicTo(SkScalar(x1), SkScalar(y1), SkScalar(x2), SkScalar(y2), SkScalar(x), SkScalar(y));
+}
+
+void SkiaPath::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    const SkRect oval = SkRect::MakeLTRB(SkScalar(cx - r), SkScalar(cy - r), SkScalar(cx + r), SkScalar(cy + r));
+    const number_t degrees = 180 / pi;
+
+    // SkPath::arcTo reduces the start and end of a full turn to the same
+    // vector and draws nothing: sweep large arcs in two halves.
+    const int n = (std::abs(da) > pi) ? 2 : 1;
+    for (int i = 0; i < n; ++i) {
+        this->_path.arcTo(oval, SkScalar((a0 + i * da / n) * degrees), SkScalar(da / n * degrees), false);
+    }
+}
+
+void SkiaPath::emitClosePath()
+{
+    this->_path.close();
+}
+
+void SkiaPath::emitRect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    // Clockwise from ⟨x, y⟩, like Path; SkRect::MakeXYWH keeps negative sizes as given.
+    this->_path.addRect(SkRect::MakeXYWH(SkScalar(x), SkScalar(y), SkScalar(w), SkScalar(h)));
+}
+
+void SkiaPath::clear()
+{
+    this->_path.reset();
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = NULL_NUMBER;
+}
+
+std::string SkiaPath::toString() const
+{
+    return std::string();
+}
+
+} // namespace d3_path
@@ -0,0 +1,55 @@
+#ifndef D3__PATH__SKIA_PATH_HPP
+#define D3__PATH__SKIA_PATH_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+
+#include "include/core/SkPath.h"
+
+namespace d3_path {
+
+/**
+ * A PathInterface that writes directly into an SkPath, without going
+ * through SVG path data.
+ *
+ * arc and arcTo resolve exactly as in Path (d3's epsilon rules, via
+ * PathNormalizer) and map onto SkPath::arcTo(oval, start, sweep), whose
+ * angles are in degrees and clockwise on screen like canvas angles; rect
+ * maps onto addRect. No text is produced: toString() returns an empty string.
+ */
+class SkiaPath final : public PathNormalizer
+{
+    SkPath _path;
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitQuadraticCurveTo(number_t x1, number_t y1, number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+    void emitRect(number_t x, number_t y, number_t w, number_t h) override;
+
+public:
+
+    SkiaPath() = default;
+
+    const SkPath& path() const { return this->_path; }
+
+    /**
+     * Forgets the geometry (and the current point).
+     */
+    void clear();
+
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__SKIA_PATH_HPP
@@ -0,0 +1,427 @@
+#include "d3_path/Stroker.hpp"
+
+#include "d3_path/detail/constants.hpp"
+
+#include <cmath> // for std::sqrt(), std::atan2(), std::cos(), std::sin(), std::abs()
+
+namespace d3_path {
+
+using detail::pi;
+
+namespace {
+
+enum Kind : unsigned char {
+    LINE,  // x, y
+    CUBIC, // x1, y1, x2, y2, x, y
+    ARC,   // cx, cy, r, a0, da
+};
+
+const std::size_t ARITY[] = { 2, 6, 5 };
+
+// Subdivision limit of a curve, against degenerate input: at most 2^10 cubics.
+const int MAX_DEPTH = 10;
+
+bool normalize(PathInterface::number_t& x, PathInterface::number_t& y)
+{
+    const PathInterface::number_t l = std::sqrt(x * x + y * y);
+    if (!(l > 0)) return false;
+    x /= l;
+    y /= l;
+    return true;
+}
+
+} // namespace
+
+struct Stroker::Segment {
+    Kind     kind;
+    number_t x0, y0; // start point
+    number_t a[6];   // arguments, as in ARITY
+
+    Segment(Kind kind, number_t x0, number_t y0, const number_t* args)
+        : kind( kind )
+        , x0( x0 )
+        , y0( y0 )
+    {
+        for (std::size_t i = 0; i < ARITY[kind]; ++i) this->a[i] = args[i];
+    }
+
+    void end(number_t& x, number_t& y) const {
+        if (this->kind == ARC) {
+            x = this->a[0] + this->a[2] * std::cos(this->a[3] + this->a[4]);
+            y = this->a[1] + this->a[2] * std::sin(this->a[3] + this->a[4]);
+        }
+        else {
+            x = this->a[ARITY[this->kind] - 2];
+            y = this->a[ARITY[this->kind] - 1];
+        }
+    }
+
+    // Unit tangents; false for a segment of zero length.
+    bool startTangent(number_t& tx, number_t& ty) const {
+        switch (this->kind) {
+        case LINE:
+            tx = this->a[0] - this->x0;
+            ty = this->a[1] - this->y0;
+            return normalize(tx, ty);
+        case CUBIC:
+            for (std::size_t i = 0; i < 6; i += 2) {
+                tx = this->a[i] - this->x0;
+                ty = this->a[i + 1] - this->y0;
+                if (normalize(tx, ty)) return true;
+            }
+            return false;
+        case ARC:
+            return this->arcTangent(this->a[3], tx, ty);
+        }
+        return false;
+    }
+
+    bool endTangent(number_t& tx, number_t& ty) const {
+        switch (this->kind) {
+        case LINE:
+            return this->startTangent(tx, ty);
+        case CUBIC:
+            for (std::size_t i = 2; i < 6; i += 2) {
+                tx = this->a[4] - this->a[4 - i];
+                ty = this->a[5] - this->a[5 - i];
+                if (normalize(tx, ty)) return true;
+            }
+            tx = this->a[4] - this->x0;
+            ty = this->a[5] - this->y0;
+            return normalize(tx, ty);
+        case ARC:
+            return this->arcTangent(this->a[3] + this->a[4], tx, ty);
+        }
+        return false;
+    }
+
+    bool arcTangent(number_t angle, number_t& tx, number_t& ty) const {
+        if (!(this->a[2] > 0) || this->a[4] == 0) return false;
+        const number_t s = (this->a[4] > 0) ? 1 : -1;
+        tx = -s * std::sin(angle);
+        ty =  s * std::cos(angle);
+        return true;
+    }
+
+    Segment reversed() const {
+        number_t x, y;
+        this->end(x, y);
+
+        Segment r = *this;
+        r.x0 = x;
+        r.y0 = y;
+        switch (this->kind) {
+        case LINE:
+            r.a[0] = this->x0;
+            r.a[1] = this->y0;
+            break;
+        case CUBIC:
+            r.a[0] = this->a[2]; r.a[1] = this->a[3];
+            r.a[2] = this->a[0]; r.a[3] = this->a[1];
+            r.a[4] = this->x0;   r.a[5] = this->y0;
+            break;
+        case ARC:
+            r.a[3] = this->a[3] + this->a[4];
+            r.a[4] = -this->a[4];
+            break;
+        }
+        return r;
+    }
+};
+
+Stroker::Stroker(PathInterface& out, const StrokeStyle& style, PathInterface::number_t tolerance)
+    : _out( out )
+    , _style( style )
+    , _tolerance( tolerance )
+    , _sx( 0 ), _sy( 0 )
+    , _firstTx( 0 ), _firstTy( 0 )
+    , _lastTx( 0 ), _lastTy( 0 )
+{ }
+
+void Stroker::addSegment(const Segment& segment)
+{
+    number_t tx, ty;
+    if (!segment.startTangent(tx, ty)) return;
+
+    const number_t hw = this->_style.width / 2;
+
+    if (this->_kinds.empty()) {
+        this->_sx = segment.x0;
+        this->_sy = segment.y0;
+        this->_firstTx = tx;
+        this->_firstTy = ty;
+        this->_out.moveTo(segment.x0 - hw * ty, segment.y0 + hw * tx);
+    }
+    else {
+        this->join(segment.x0, segment.y0, this->_lastTx, this->_lastTy, tx, ty);
+    }
+
+    this->offset(segment);
+    segment.endTangent(this->_lastTx, this->_lastTy);
+
+    this->_kinds.push_back(segment.kind);
+    this->_args.insert(this->_args.end(), segment.a, segment.a + ARITY[segment.kind]);
+}
+
+void Stroker::offset(const Segment& segment)
+{
+    const number_t hw = this->_style.width / 2;
+
+    switch (segment.kind) {
+    case LINE: {
+        number_t tx, ty;
+        segment.startTangent(tx, ty);
+        this->_out.lineTo(segment.a[0] - hw * ty, segment.a[1] + hw * tx);
+        break;
+    }
+    case CUBIC: {
+        const number_t p[8] = { segment.x0, segment.y0, segment.a[0], segment.a[1], segment.a[2], segment.a[3], segment.a[4], segment.a[5] };
+        this->offsetCubic(p, 0);
+        break;
+    }
+    case ARC: {
+        // The offset normal points to the center of clockwise arcs, away from it otherwise.
+        const number_t
+                cx = segment.a[0],
+                cy = segment.a[1],
+                a0 = segment.a[3],
+                da = segment.a[4],
+                r  = segment.a[2] - ((da > 0) ? hw : -hw);
+        if (r >= 0) this->_out.arc(cx, cy, r, a0, a0 + da, da < 0);
+        else        this->_out.arc(cx, cy, -r, a0 + pi, a0 + pi + da, da < 0);
+        break;
+    }
+    }
+}
+
+void Stroker::offsetCubic(const PathInterface::number_t* p, int depth)
+{
+    const number_t hw = this->_style.width / 2;
+
+    // Unit tangents at both ends, then the control polygon legs translated along them.
+    const Segment segment(CUBIC, p[0], p[1], p + 2);
+    number_t tx0, ty0, tx3, ty3;
+    segment.startTangent(tx0, ty0);
+    segment.endTangent(tx3, ty3);
+
+    const number_t
+            qx0 = p[0] - hw * ty0, qy0 = p[1] + hw * tx0,
+            qx3 = p[6] - hw * ty3, qy3 = p[7] + hw * tx3,
+            qx1 = qx0 + (p[2] - p[0]), qy1 = qy0 + (p[3] - p[1]),
+            qx2 = qx3 + (p[4] - p[6]), qy2 = qy3 + (p[5] - p[7]);
+
+    // Compare with the exact offset at t = ¼, ½, ¾.
+    bool split = false;
+    for (int i = 1; i < 4 && !split && depth < MAX_DEPTH; ++i) {
+        const number_t
+                t = i / number_t(4),
+                mt = 1 - t,
+                b0 = mt * mt * mt, b1 = 3 * mt * mt * t, b2 = 3 * mt * t * t, b3 = t * t * t,
+                d0 = mt * mt, d1 = 2 * mt * t, d2 = t * t;
+        number_t
+                dx = d0 * (p[2] - p[0]) + d1 * (p[4] - p[2]) + d2 * (p[6] - p[4]),
+                dy = d0 * (p[3] - p[1]) + d1 * (p[5] - p[3]) + d2 * (p[7] - p[5]);
+        if (!normalize(dx, dy)) {
+            split = true;
+            break;
+        }
+        const number_t
+                ex = b0 * p[0] + b1 * p[2] + b2 * p[4] + b3 * p[6] - hw * dy,
+                ey = b0 * p[1] + b1 * p[3] + b2 * p[5] + b3 * p[7] + hw * dx,
+                ax = b0 * qx0 + b1 * qx1 + b2 * qx2 + b3 * qx3,
+                ay = b0 * qy0 + b1 * qy1 + b2 * qy2 + b3 * qy3;
+        split = ((ax - ex) * (ax - ex) + (ay - ey) * (ay - ey) > this->_tolerance * this->_tolerance);
+    }
+
+    if (!split) {
+        this->_out.bezierCurveTo(qx1, qy1, qx2, qy2, qx3, qy3);
+        return;
+    }
+
+    // de Casteljau at t = ½.
+    const number_t
+            x01 = (p[0] + p[2]) / 2, y01 = (p[1] + p[3]) / 2,
+            x12 = (p[2] + p[4]) / 2, y12 = (p[3] + p[5]) / 2,
+            x23 = (p[4] + p[6]) / 2, y23 = (p[5] + p[7]) / 2,
+            xa = (x01 + x12) / 2, ya = (y01 + y12) / 2,
+            xb = (x12 + x23) / 2, yb = (y12 + y23) / 2,
+            xm = (xa + xb) / 2, ym = (ya + yb) / 2;
+    const number_t
+            left[8]  = { p[0], p[1], x01, y01, xa, ya, xm, ym },
+            right[8] = { xm, ym, xb, yb, x23, y23, p[6], p[7] };
+    this->offsetCubic(left, depth + 1);
+    this->offsetCubic(right, depth + 1);
+}
+
+void Stroker::join(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t tx0, PathInterface::number_t ty0, PathInterface::number_t tx1, PathInterface::number_t ty1)
+{
+    const number_t
+            hw = this->_style.width / 2,
+            cross = tx0 * ty1 - ty0 * tx1,
+            dot = tx0 * tx1 + ty0 * ty1,
+            bx = x - hw * ty1,
+            by = y + hw * tx1;
+
+    // Straight on: nothing to fill.
+    if (std::abs(cross) < 1e-9 && dot > 0) {
+        this->_out.lineTo(bx, by);
+        return;
+    }
+
+    // Inner side: through the vertex, which the other side's outline covers.
+    if (cross > 0) {
+        this->_out.lineTo(x, y);
+        this->_out.lineTo(bx, by);
+        return;
+    }
+
+    switch (this->_style.join) {
+    case LineJoin::Round: {
+        // The outer side, or a U-turn: around the front of the vertex.
+        const number_t
+                a0 = std::atan2(tx0, -ty0),
+                turn = -std::abs(std::atan2(cross, dot));
+        this->_out.arc(x, y, hw, a0, a0 + turn, true);
+        break;
+    }
+    case LineJoin::Miter: {
+        // The miter tip is 1 / cos(θ / 2) half widths away, θ being the turn angle.
+        const number_t cosHalf = std::sqrt((1 + dot) / 2);
+        if (cosHalf * this->_style.miterLimit >= 1) {
+            const number_t k = hw / (1 + dot);
+            this->_out.lineTo(x - k * (ty0 + ty1), y + k * (tx0 + tx1));
+        }
+        this->_out.lineTo(bx, by);
+        break;
+    }
+    case LineJoin::Bevel:
+        this->_out.lineTo(bx, by);
+        break;
+    }
+}
+
+void Stroker::cap(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t tx, PathInterface::number_t ty)
+{
+    // From the offset (x - hw·ty, y + hw·tx) to the opposite one, around the end.
+    const number_t hw = this->_style.width / 2;
+
+    switch (this->_style.cap) {
+    case LineCap::Butt:
+        break;
+    case LineCap::Square:
+        this->_out.lineTo(x - hw * ty + hw * tx, y + hw * tx + hw * ty);
+        this->_out.lineTo(x + hw * ty + hw * tx, y - hw * tx + hw * ty);
+        break;
+    case LineCap::Round: {
+        const number_t a0 = std::atan2(tx, -ty);
+        this->_out.arc(x, y, hw, a0, a0 - pi, true);
+        break;
+    }
+    }
+    this->_out.lineTo(x + hw * ty, y - hw * tx);
+}
+
+void Stroker::endSubpath(bool closed)
+{
+    if (this->_kinds.empty()) return;
+
+    const std::size_t n = this->_kinds.size();
+
+    if (closed) {
+        this->join(this->_sx, this->_sy, this->_lastTx, this->_lastTy, this->_firstTx, this->_firstTy);
+        this->_out.closePath();
+    }
+    else {
+        number_t x, y;
+        std::size_t k = this->_args.size() - ARITY[this->_kinds[n - 1]];
+        Segment(static_cast<Kind>(this->_kinds[n - 1]), 0, 0, this->_args.data() + k).end(x, y);
+        this->cap(x, y, this->_lastTx, this->_lastTy);
+    }
+
+    // The other side: the segments backwards, offset the same way in their reversed direction.
+    const number_t hw = this->_style.width / 2;
+    number_t tx = 0, ty = 0, firstTx = 0, firstTy = 0;
+    std::size_t k = this->_args.size();
+
+    for (std::size_t i = n; i-- > 0;) {
+        const Kind kind = static_cast<Kind>(this->_kinds[i]);
+        k -= ARITY[kind];
+
+        number_t x0 = this->_sx, y0 = this->_sy;
+        if (i > 0) {
+            const Kind previous = static_cast<Kind>(this->_kinds[i - 1]);
+            Segment(previous, 0, 0, this->_args.data() + k - ARITY[previous]).end(x0, y0);
+        }
+        const Segment segment = Segment(kind, x0, y0, this->_args.data() + k).reversed();
+
+        number_t sx = 0, sy = 0;
+        segment.startTangent(sx, sy);
+        if (i == n - 1) {
+            firstTx = sx;
+            firstTy = sy;
+            if (closed) this->_out.moveTo(segment.x0 - hw * sy, segment.y0 + hw * sx);
+        }
+        else {
+            this->join(segment.x0, segment.y0, tx, ty, sx, sy);
+        }
+
+        this->offset(segment);
+        segment.endTangent(tx, ty);
+    }
+
+    if (closed) {
+        this->join(this->_sx, this->_sy, tx, ty, firstTx, firstTy);
+    }
+    else {
+        this->cap(this->_sx, this->_sy, tx, ty);
+    }
+    this->_out.closePath();
+
+    this->_kinds.clear();
+    this->_args.clear();
+}
+
+void Stroker::emitMoveTo(PathInterface::number_t, PathInterface::number_t)
+{
+    this->endSubpath(false);
+}
+
+void Stroker::emitLineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    const number_t args[] = { x, y };
+    this->addSegment( Segment(LINE, this->_x1, this->_y1, args) );
+}
+
+void Stroker::emitBezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    const number_t args[] = { x1, y1, x2, y2, x, y };
+    this->addSegment( Segment(CUBIC, this->_x1, this->_y1, args) );
+}
+
+void Stroker::emitArc(PathInterface::number_t cx, PathInterface::number_t cy, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t da)
+{
+    const number_t args[] = { cx, cy, r, a0, da };
+    this->addSegment( Segment(ARC, this->_x1, this->_y1, args) );
+}
+
+void Stroker::emitClosePath()
+{
+    // The closing segment, back to the subpath start.
+    if (this->_x1 != this->_x0 || this->_y1 != this->_y0) {
+        const number_t args[] = { this->_x0, this->_y0 };
+        this->addSegment( Segment(LINE, this->_x1, this->_y1, args) );
+    }
+    this->endSubpath(true);
+}
+
+void Stroker::finish()
+{
+    this->endSubpath(false);
+}
+
+std::string Stroker::toString() const
+{
+    return this->_out.toString();
+}
+
+} // namespace d3_path
@@ -0,0 +1,115 @@
+#ifndef D3__PATH__STROKER_HPP
+#define D3__PATH__STROKER_HPP
+
+#include "d3_path/PathNormalizer.hpp"
+
+#include <vector>
+
+namespace d3_path {
+
+enum class LineJoin {
+    Miter,
+    Round,
+    Bevel,
+};
+
+enum class LineCap {
+    Butt,
+    Round,
+    Square,
+};
+
+/**
+ * Stroke parameters, with the defaults of a canvas 2D context.
+ */
+struct StrokeStyle
+{
+    using number_t = PathInterface::number_t;
+
+    number_t width;
+    LineJoin join;
+    LineCap  cap;
+    number_t miterLimit; // beyond miterLimit × width / 2 from the vertex, miters become bevels
+
+    StrokeStyle(number_t width = 1, LineJoin join = LineJoin::Miter, LineCap cap = LineCap::Butt, number_t miterLimit = 10)
+        : width( width )
+        , join( join )
+        , cap( cap )
+        , miterLimit( miterLimit )
+    { }
+};
+
+/**
+ * A PathInterface that forwards the outline of the stroke of the path it
+ * receives to another PathInterface, as closed contours to be filled with
+ * the nonzero rule (by a Rasterizer, a Tessellator, or an SVG fill).
+ *
+ * Both sides of every segment are offset by width / 2: lines stay lines,
+ * arcs become concentric arcs, and curves are approximated by cubics
+ * within `tolerance`, subdividing as needed. An open subpath becomes one
+ * contour (one side, end cap, the other side backwards, start cap), a
+ * closed one two contours (one side, the other side backwards).
+ *
+ * The first side is forwarded as segments arrive; only the current subpath
+ * is kept, compactly, to walk back the other side when it ends - at the
+ * next moveTo, rect or closePath, or at finish().
+ */
+class Stroker final : public PathNormalizer
+{
+    struct Segment;
+
+    PathInterface& _out;
+    StrokeStyle    _style;
+    number_t       _tolerance;
+
+    // Current subpath: segment kinds and their arguments, start points implied.
+    std::vector<unsigned char> _kinds;
+    std::vector<number_t>      _args;
+    number_t _sx, _sy;             // start point
+    number_t _firstTx, _firstTy;   // start tangent of the first segment
+    number_t _lastTx, _lastTy;     // end tangent of the last segment
+
+    void addSegment(const Segment& segment);
+
+    void endSubpath(bool closed);
+
+    void offset(const Segment& segment);
+
+    void offsetCubic(const number_t* p, int depth);
+
+    void join(number_t x, number_t y, number_t tx0, number_t ty0, number_t tx1, number_t ty1);
+
+    void cap(number_t x, number_t y, number_t tx, number_t ty);
+
+protected:
+
+    void emitMoveTo(number_t x, number_t y) override;
+
+    void emitLineTo(number_t x, number_t y) override;
+
+    void emitBezierCurveTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t x, number_t y) override;
+
+    void emitArc(number_t cx, number_t cy, number_t r, number_t a0, number_t da) override;
+
+    void emitClosePath() override;
+
+public:
+
+    Stroker(PathInterface& out, const StrokeStyle& style = StrokeStyle(), number_t tolerance = 0.1);
+
+    const StrokeStyle& style() const { return this->_style; }
+
+    /**
+     * Outlines the pending open subpath, if any. Call it after the last path call.
+     */
+    void finish();
+
+    /**
+     * Returns the output's toString(), without the pending subpath: call finish() first.
+     */
+    std::string toString() const override;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__STROKER_HPP
@@ -0,0 +1,54 @@
+#include "d3_path/TeePath.hpp"
+
+namespace d3_path {
+
+TeePath::TeePath(std::initializer_list<PathInterface*> targets)
+    : _targets( targets )
+{ }
+
+void TeePath::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    for (PathInterface* target : this->_targets) target->moveTo(x, y);
+}
+
+void TeePath::closePath()
+{
+    for (PathInterface* target : this->_targets) target->closePath();
+}
+
+void TeePath::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    for (PathInterface* target : this->_targets) target->lineTo(x, y);
+}
+
+void TeePath::quadraticCurveTo(PathInterface::number_t cpx, PathInterface::number_t cpy, PathInterface::number_t x, PathInterface::number_t y)
+{
+    for (PathInterface* target : this->_targets) target->quadraticCurveTo(cpx, cpy, x, y);
+}
+
+void TeePath::bezierCurveTo(PathInterface::number_t cpx1, PathInterface::number_t cpy1, PathInterface::number_t cpx2, PathInterface::number_t cpy2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    for (PathInterface* target : this->_targets) target->bezierCurveTo(cpx1, cpy1, cpx2, cpy2, x, y);
+}
+
+void TeePath::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t radius)
+{
+    for (PathInterface* target : this->_targets) target->arcTo(x1, y1, x2, y2, radius);
+}
+
+void TeePath::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t radius, PathInterface::number_t startAngle, PathInterface::number_t endAngle, bool anticlockwise)
+{
+    for (PathInterface* target : this->_targets) target->arc(x, y, radius, startAngle, endAngle, anticlockwise);
+}
+
+void TeePath::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    for (PathInterface* target : this->_targets) target->rect(x, y, w, h);
+}
+
+std::string TeePath::toString() const
+{
+    return this->_targets.empty() ? std::string() : this->_targets.front()->toString();
+}
+
+} // namespace d3_path
@@ -0,0 +1,183 @@
+#ifndef D3__PATH__TEE_PATH_HPP
+#define D3__PATH__TEE_PATH_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <vector>
+#include <initializer_list>
+
+namespace d3_path {
+
+/**
+ * A PathInterface that forwards every call, unchanged, to each of its
+ * targets in order: one pass of a generator fills e.g. a Path, a
+ * RecordedPath and a Rasterizer at once.
+ *
+ * toString() is the first target's.
+ */
+class TeePath : public PathInterface
+{
+    std::vector<PathInterface*> _targets;
+
+public:
+
+    TeePath() = default;
+
+    TeePath(std::initializer_list<PathInterface*> targets);
+
+    void add(PathInterface& target) { this->_targets.push_back(&target); }
+
+    const std::vector<PathInterface*>& targets() const { return this->_targets; }
+
+    void moveTo(number_t x, number_t y) override;
+
+    void closePath() override;
+
+    void lineTo(number_t x, number_t y) override;
+
+    void quadraticCurveTo(number_t cpx, number_t cpy, number_t x, number_t y) override;
+
+    void bezierCurveTo(number_t cpx1, number_t cpy1, number_t cpx2, number_t cpy2, number_t x, number_t y) override;
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t radius) override;
+
+    void arc(number_t x, number_t y, number_t radius, number_t startAngle, number_t endAngle, bool anticlockwise = false) override;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override;
+
+    std::string toString() const override;
+};
+
+namespace detail {
+
+// Calls each target through its own type: for a final type (Path,
+// RecordedPath, Rasterizer, …) the compiler resolves the calls statically
+// and can inline them; other types dispatch as usual, overrides included.
+template <typename... Targets>
+struct TeeChain;
+
+template <>
+struct TeeChain<>
+{
+    using number_t = PathInterface::number_t;
+
+    void moveTo(number_t, number_t) { }
+    void closePath() { }
+    void lineTo(number_t, number_t) { }
+    void quadraticCurveTo(number_t, number_t, number_t, number_t) { }
+    void bezierCurveTo(number_t, number_t, number_t, number_t, number_t, number_t) { }
+    void arcTo(number_t, number_t, number_t, number_t, number_t) { }
+    void arc(number_t, number_t, number_t, number_t, number_t, bool) { }
+    void rect(number_t, number_t, number_t, number_t) { }
+};
+
+template <typename Target, typename... Rest>
+struct TeeChain<Target, Rest...>
+{
+    using number_t = PathInterface::number_t;
+
+    Target&           head;
+    TeeChain<Rest...> tail;
+
+    TeeChain(Target& target, Rest&... rest)
+        : head( target )
+        , tail{ rest... }
+    { }
+
+    void moveTo(number_t x, number_t y) {
+        this->head.moveTo(x, y);
+        this->tail.moveTo(x, y);
+    }
+    void closePath() {
+        this->head.closePath();
+        this->tail.closePath();
+    }
+    void lineTo(number_t x, number_t y) {
+        this->head.lineTo(x, y);
+        this->tail.lineTo(x, y);
+    }
+    void quadraticCurveTo(number_t cpx, number_t cpy, number_t x, number_t y) {
+        this->head.quadraticCurveTo(cpx, cpy, x, y);
+        this->tail.quadraticCurveTo(cpx, cpy, x, y);
+    }
+    void bezierCurveTo(number_t cpx1, number_t cpy1, number_t cpx2, number_t cpy2, number_t x, number_t y) {
+        this->head.bezierCurveTo(cpx1, cpy1, cpx2, cpy2, x, y);
+        this->tail.bezierCurveTo(cpx1, cpy1, cpx2, cpy2, x, y);
+    }
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t radius) {
+        this->head.arcTo(x1, y1, x2, y2, radius);
+        this->tail.arcTo(x1, y1, x2, y2, radius);
+    }
+    void arc(number_t x, number_t y, number_t radius, number_t startAngle, number_t endAngle, bool anticlockwise) {
+        this->head.arc(x, y, radius, startAngle, endAngle, anticlockwise);
+        this->tail.arc(x, y, radius, startAngle, endAngle, anticlockwise);
+    }
+    void rect(number_t x, number_t y, number_t w, number_t h) {
+        this->head.rect(x, y, w, h);
+        this->tail.rect(x, y, w, h);
+    }
+};
+
+} // namespace detail
+
+/**
+ * TeePath over targets whose types are known at compile time: with final
+ * target types the forwarding is resolved statically, one virtual call
+ * into the tee at most. Generators templated on their path type call it
+ * directly.
+ *
+ * @code
+ *     d3_path::Path svg;
+ *     d3_path::RecordedPath recorded;
+ *     auto both = d3_path::tee(svg, recorded);
+ *     generate(both);
+ * @endcode
+ */
+template <typename... Targets>
+class StaticTeePath final : public PathInterface
+{
+    static_assert(sizeof...(Targets) > 0, "StaticTeePath needs at least one target");
+
+    detail::TeeChain<Targets...> _chain;
+
+public:
+
+    explicit StaticTeePath(Targets&... targets)
+        : _chain( targets... )
+    { }
+
+    void moveTo(number_t x, number_t y) override { this->_chain.moveTo(x, y); }
+
+    void closePath() override { this->_chain.closePath(); }
+
+    void lineTo(number_t x, number_t y) override { this->_chain.lineTo(x, y); }
+
+    void quadraticCurveTo(number_t cpx, number_t cpy, number_t x, number_t y) override {
+        this->_chain.quadraticCurveTo(cpx, cpy, x, y);
+    }
+
+    void bezierCurveTo(number_t cpx1, number_t cpy1, number_t cpx2, number_t cpy2, number_t x, number_t y) override {
+        this->_chain.bezierCurveTo(cpx1, cpy1, cpx2, cpy2, x, y);
+    }
+
+    void arcTo(number_t x1, number_t y1, number_t x2, number_t y2, number_t radius) override {
+        this->_chain.arcTo(x1, y1, x2, y2, radius);
+    }
+
+    void arc(number_t x, number_t y, number_t radius, number_t startAngle, number_t endAngle, bool anticlockwise = false) override {
+        this->_chain.arc(x, y, radius, startAngle, endAngle, anticlockwise);
+    }
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override { this->_chain.rect(x, y, w, h); }
+
+    std::string toString() const override { return this->_chain.head.toString(); }
+};
+
+template <typename... Targets>
+inline StaticTeePath<Targets...> tee(Targets&... targets) {
+    return StaticTeePath<Targets...>(targets...);
+}
+
+} // namespace d3_path
+
+#endif // D3__PATH__TEE_PATH_HPP
@@ -0,0 +1,194 @@
+#include "d3_path/Tessellator.hpp"
+
+#include <cmath>     // for std::isfinite()
+#include <cstring>   // for std::memcpy()
+#include <algorithm> // for std::sort(), std::unique(), std::min(), std::max()
+
+namespace d3_path {
+
+namespace {
+
+const std::size_t NONE = static_cast<std::size_t>(-1);
+
+} // namespace
+
+std::size_t Tessellator::PointHash::operator()(const std::pair<number_t, number_t>& p) const
+{
+    std::uint64_t x, y;
+    std::memcpy(&x, &p.first, sizeof(x));
+    std::memcpy(&y, &p.second, sizeof(y));
+    return static_cast<std::size_t>( (x * 0x9e3779b97f4a7c15ull) ^ (y + 0x632be59bd9b4e019ull + (x << 6)) );
+}
+
+Tessellator::Tessellator(PathInterface::number_t tolerance)
+    : PathFlattener( tolerance )
+{ }
+
+std::uint32_t Tessellator::vertex(Mesh& mesh, PathInterface::number_t x, PathInterface::number_t y) const
+{
+    const std::uint32_t id = static_cast<std::uint32_t>( mesh.vertexCount() );
+    const auto inserted = this->_vertexIds.emplace(std::make_pair(x, y), id);
+    if (!inserted.second) return inserted.first->second;
+
+    mesh.vertices.push_back(static_cast<float>(x));
+    mesh.vertices.push_back(static_cast<float>(y));
+    return id;
+}
+
+void Tessellator::emitTrapezoid(Mesh& mesh, const Span& span, PathInterface::number_t bottom) const
+{
+    const Edge
+            &left = this->_edges[span.left],
+            &right = this->_edges[span.right];
+    const number_t top = this->_ys[span.top];
+
+    const std::uint32_t
+            lt = this->vertex(mesh, left.x(top), top),
+            rt = this->vertex(mesh, right.x(top), top),
+            rb = this->vertex(mesh, right.x(bottom), bottom),
+            lb = this->vertex(mesh, left.x(bottom), bottom);
+
+    // Clockwise on screen; a corner shared by both edges leaves a triangle.
+    if (lt != rt) mesh.indices.insert(mesh.indices.end(), { lt, rt, rb });
+    if (lb != rb) mesh.indices.insert(mesh.indices.end(), { lt, rb, lb });
+}
+
+void Tessellator::fill(Mesh& mesh, FillRule rule) const
+{
+    std::vector<Edge>& edges = this->_edges;
+    std::vector<std::size_t>& byTop = this->_byTop;
+    std::vector<number_t>& ys = this->_ys;
+    std::vector<Sorted>& active = this->_active;
+
+    edges.clear();
+    ys.clear();
+
+    // Edges of every contour, implicitly closed; horizontal ones bound no slab.
+    for (const Contour& contour : this->_contours) {
+        if (contour.size() < 2) continue;
+
+        for (std::size_t i = contour.begin; i < contour.end; ++i) {
+            const Point
+                    a = this->_points[i],
+                    b = this->_points[(i + 1 < contour.end) ? i + 1 : contour.begin];
+
+            if (a.y == b.y) continue;
+            if (!std::isfinite(a.x) || !std::isfinite(a.y) || !std::isfinite(b.x) || !std::isfinite(b.y)) continue;
+
+            Edge edge = (a.y < b.y) ? Edge{ a.x, a.y, b.x, b.y, 0, 1 } : Edge{ b.x, b.y, a.x, a.y, 0, -1 };
+            edge.dxdy = (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+            edges.push_back(edge);
+            ys.push_back(edge.y0);
+            ys.push_back(edge.y1);
+        }
+    }
+    if (edges.empty()) return;
+
+    byTop.resize(edges.size());
+    for (std::size_t i = 0; i < edges.size(); ++i) byTop[i] = i;
+    std::sort(byTop.begin(), byTop.end(), [&edges](std::size_t a, std::size_t b) {
+        return edges[a].y0 < edges[b].y0 || (edges[a].y0 == edges[b].y0 && a < b);
+    });
+
+    // Slab boundaries at edge crossings: sweep down, testing each edge
+    // against the ones still active where it starts.
+    active.clear();
+    for (const std::size_t i : byTop) {
+        const Edge& e = edges[i];
+
+        std::size_t kept = 0;
+        for (const Sorted& s : active) {
+            const Edge& a = edges[s.edge];
+            if (a.y1 <= e.y0) continue;
+            active[kept++] = s;
+
+            const number_t
+                    top = e.y0,
+                    bottom = std::min(a.y1, e.y1),
+                    dTop = a.x(top) - e.x(top),
+                    dBottom = a.x(bottom) - e.x(bottom);
+            if ((dTop < 0 && dBottom > 0) || (dTop > 0 && dBottom < 0)) {
+                const number_t y = top + (bottom - top) * (dTop / (dTop - dBottom));
+                if (y > top && y < bottom) ys.push_back(y);
+            }
+        }
+        active.resize(kept);
+        active.push_back( Sorted{0, i} );
+    }
+
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    // Sweep the slabs, extending the spans that keep the same pair of edges.
+    std::vector<Span>& spans = this->_spans;
+    std::vector<Span>& previous = this->_previous;
+    std::vector<std::size_t>& leftOf = this->_leftOf;
+
+    leftOf.assign(edges.size(), NONE);
+    previous.clear();
+    active.clear();
+    this->_vertexIds.clear();
+
+    std::size_t next = 0;
+    for (std::size_t k = 0; k + 1 < ys.size(); ++k) {
+        const number_t
+                top = ys[k],
+                bottom = ys[k + 1],
+                middle = (top + bottom) / 2;
+
+        std::size_t kept = 0;
+        for (const Sorted& s : active) {
+            if (edges[s.edge].y1 > top) active[kept++] = s;
+        }
+        active.resize(kept);
+        for (; next < byTop.size() && edges[byTop[next]].y0 <= top; ++next) {
+            active.push_back( Sorted{0, byTop[next]} );
+        }
+
+        // The order changes little from one slab to the next: insertion sort.
+        for (Sorted& s : active) s.x = edges[s.edge].x(middle);
+        for (std::size_t i = 1; i < active.size(); ++i) {
+            const Sorted s = active[i];
+            std::size_t j = i;
+            for (; j > 0 && (active[j - 1].x > s.x || (active[j - 1].x == s.x && active[j - 1].edge > s.edge)); --j) {
+                active[j] = active[j - 1];
+            }
+            active[j] = s;
+        }
+
+        spans.clear();
+        int winding = 0;
+        std::size_t left = NONE;
+        for (const Sorted& s : active) {
+            winding += edges[s.edge].dir;
+            const bool inside = (rule == FillRule::NonZero) ? (winding != 0) : (winding % 2 != 0);
+            if (inside && left == NONE) {
+                left = s.edge;
+            }
+            else if (!inside && left != NONE) {
+                spans.push_back( Span{left, s.edge, k} );
+                left = NONE;
+            }
+        }
+
+        for (Span& span : spans) {
+            const std::size_t p = leftOf[span.left];
+            if (p != NONE && previous[p].right == span.right) {
+                span.top = previous[p].top;
+                previous[p].left = NONE; // carried over
+            }
+        }
+        for (const Span& span : previous) {
+            if (span.left == NONE) continue;
+            leftOf[span.left] = NONE;
+            this->emitTrapezoid(mesh, span, top);
+        }
+        for (std::size_t i = 0; i < spans.size(); ++i) leftOf[spans[i].left] = i;
+
+        std::swap(spans, previous);
+    }
+
+    for (const Span& span : previous) this->emitTrapezoid(mesh, span, ys.back());
+}
+
+} // namespace d3_path
@@ -0,0 +1,83 @@
+#ifndef D3__PATH__TESSELLATOR_HPP
+#define D3__PATH__TESSELLATOR_HPP
+
+#include "d3_path/PathFlattener.hpp"
+#include "d3_path/FillRule.hpp"
+#include "d3_path/Mesh.hpp"
+
+#include <unordered_map>
+
+namespace d3_path {
+
+/**
+ * A PathInterface that triangulates the fill of the path it receives.
+ *
+ * Sweep-line trapezoidation: the plane is cut into horizontal slabs at
+ * every vertex and edge crossing, so no two edges cross inside a slab.
+ * Within a slab, the edges sorted by x and the winding number give the
+ * spans to fill; a span bounded by the same pair of edges over several
+ * slabs becomes a single trapezoid (two triangles). Self-intersecting,
+ * overlapping and nested contours are handled by the fill rule alone.
+ *
+ * Triangles are clockwise on screen (y down). The output only depends on
+ * the input - no hashing of pointers, no threads - so meshes are
+ * reproducible. Drawing works like Rasterizer: build the path, fill() it,
+ * then clear() it.
+ */
+class Tessellator final : public PathFlattener
+{
+    struct Edge {
+        number_t x0, y0, x1, y1; // y0 < y1
+        number_t dxdy;
+        int      dir;            // +1 downwards in the path, -1 upwards
+
+        number_t x(number_t y) const {
+            return (y == this->y0) ? this->x0 : (y == this->y1) ? this->x1 : this->x0 + (y - this->y0) * this->dxdy;
+        }
+    };
+
+    struct Span {
+        std::size_t left, right; // edges
+        std::size_t top;         // index into _ys
+    };
+
+    struct Sorted {
+        number_t    x;
+        std::size_t edge;
+    };
+
+    struct PointHash {
+        std::size_t operator()(const std::pair<number_t, number_t>& p) const;
+    };
+
+    // Scratch buffers, kept between fill() calls.
+    mutable std::vector<Edge>        _edges;
+    mutable std::vector<std::size_t> _byTop;
+    mutable std::vector<number_t>    _ys;
+    mutable std::vector<Sorted>      _active;
+    mutable std::vector<Span>        _spans, _previous;
+    mutable std::vector<std::size_t> _leftOf;
+    mutable std::unordered_map<std::pair<number_t, number_t>, std::uint32_t, PointHash> _vertexIds;
+
+    std::uint32_t vertex(Mesh& mesh, number_t x, number_t y) const;
+
+    void emitTrapezoid(Mesh& mesh, const Span& span, number_t bottom) const;
+
+public:
+
+    /**
+     * `tolerance` is the flattening tolerance of curves, in output units.
+     */
+    Tessellator(number_t tolerance = 0.25);
+
+    /**
+     * Appends the triangles covering the current path to `mesh`, every
+     * contour implicitly closed. Vertices shared within this call are
+     * written once.
+     */
+    void fill(Mesh& mesh, FillRule rule = FillRule::NonZero) const;
+};
+
+} // namespace d3_path
+
+#endif // D3__PATH__TESSELLATOR_HPP
@@ -0,0 +1,324 @@
+#ifndef D3__PATH__DETAIL__BASIC_PATH_HPP
+#define D3__PATH__DETAIL__BASIC_PATH_HPP
+
+// BasicPath's member definitions: Path.cpp instantiates them for the buffers
+// declared with `extern template`, headers of other buffers include them for
+// the rest (e.g. InlinePath<N> of any N).
+
+#include "d3_path/Path.hpp"
+#include "d3_path/detail/constants.hpp"
+#include "d3_path/detail/to_str.hpp"
+
+#include <cstdio>    // for std::snprintf()
+#include <clocale>   // for std::localeconv()
+#include <cstring>   // for std::strlen(), std::strstr(), std::memmove()
+#include <algorithm> // for std::min()
+#include <cmath>     // for std::isnan(), std::abs(), std::sqrt(), std::tan(), std::acos(), std::cos(), std::sin()
+#include <stdexcept> // for std::runtime_error()
+#include <utility>   // for std::move()
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#  if __has_include(<charconv>)
+#    include <charconv> // for std::to_chars()
+#  endif
+#endif
+
+namespace d3_path {
+namespace detail {
+
+// One command, formatted on the stack and appended to the buffer in one go,
+// without temporary strings. Numbers come out as from to_str() ("%g"), with
+// a '.' whatever the C locale (setlocale()) says.
+class Chars
+{
+    char        _data[512];
+    std::size_t _size;
+
+public:
+
+    Chars()
+        : _size( 0 )
+    { }
+
+    Chars& operator<<(char c) {
+        this->_data[this->_size++] = c;
+        return *this;
+    }
+
+    Chars& operator<<(const char* s) {
+        while (*s) this->_data[this->_size++] = *s++;
+        return *this;
+    }
+
+    Chars& operator<<(PathInterface::number_t value) {
+        char* const out = this->_data + this->_size;
+        const std::size_t room = sizeof(this->_data) - this->_size;
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        const std::to_chars_result result = std::to_chars(out, out + room - 1, value, std::chars_format::general, 6);
+        if (result.ec == std::errc()) this->_size += result.ptr - out;
+#else
+        const int n = std::snprintf(out, room, "%g", value);
+        if (n <= 0) return *this;
+
+        std::size_t size = std::min(static_cast<std::size_t>(n), room - 1);
+        const char* point = std::localeconv()->decimal_point;
+        if (point[0] != '.' || point[1] != '\0') {
+            char* found = std::strstr(out, point);
+            if (found != nullptr) {
+                const std::size_t length = std::strlen(point);
+                *found = '.';
+                std::memmove(found + 1, found + length, out + size - (found + length));
+                size -= length - 1;
+            }
+        }
+        this->_size += size;
+#endif
+        return *this;
+    }
+
+    Chars& operator<<(int value) { return *this << static_cast<PathInterface::number_t>(value); }
+
+    const char* data() const { return this->_data; }
+
+    std::size_t size() const { return this->_size; }
+};
+
+// Whole-buffer access for BasicPath, through data() and size(). Buffers
+// without data() (RopeBuffer) overload these in their own namespace, found
+// by argument-dependent lookup.
+
+template <typename Buffer>
+std::string bufferString(const Buffer& buffer) { return std::string(buffer.data(), buffer.size()); }
+
+template <typename Buffer>
+void appendBuffer(Buffer& buffer, const Buffer& other) { buffer.append(other.data(), other.size()); }
+
+template <typename Buffer>
+std::string takeBuffer(Buffer& buffer) { return bufferString(buffer); }
+
+inline std::string takeBuffer(std::string& buffer) { return std::move(buffer); }
+
+} // namespace detail
+
+template <typename Buffer>
+BasicPath<Buffer>::BasicPath()
+    : _x0( detail::NULL_NUMBER )
+    , _y0( detail::NULL_NUMBER )
+    , _x1( detail::NULL_NUMBER )
+    , _y1( detail::NULL_NUMBER )
+    , _xm( detail::NULL_NUMBER )
+    , _ym( detail::NULL_NUMBER )
+{ }
+
+template <typename Buffer>
+BasicPath<Buffer>::BasicPath(Buffer buffer)
+    : _x0( detail::NULL_NUMBER )
+    , _y0( detail::NULL_NUMBER )
+    , _x1( detail::NULL_NUMBER )
+    , _y1( detail::NULL_NUMBER )
+    , _xm( detail::NULL_NUMBER )
+    , _ym( detail::NULL_NUMBER )
+    , _( std::move(buffer) )
+{ }
+
+template <typename Buffer>
+void BasicPath<Buffer>::moveTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->put(detail::Chars() << 'M' << (this->_x0 = this->_x1 = x) << ',' << (this->_y0 = this->_y1 = y));
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::closePath()
+{
+    if ( std::isnan( this->_x1 ) == false ) {
+        this->_x1 = this->_x0; this->_y1 = this->_y0;
+        this->put(detail::Chars() << 'Z');
+    }
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::lineTo(PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->put(detail::Chars() << 'L' << (this->_x1 = x) << ',' << (this->_y1 = y));
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::quadraticCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->put(detail::Chars() << 'Q' << x1 << ',' << y1 << ',' << (this->_x1 = x) << ',' << (this->_y1 = y));
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::bezierCurveTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t x, PathInterface::number_t y)
+{
+    this->put(detail::Chars() << 'C' << x1 << ',' << y1 << ',' << x2 << ',' << y2 << ',' << (this->_x1 = x) << ',' << (this->_y1 = y));
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::arcTo(PathInterface::number_t x1, PathInterface::number_t y1, PathInterface::number_t x2, PathInterface::number_t y2, PathInterface::number_t r)
+{
+    const number_t
+            x0 = this->_x1,
+            y0 = this->_y1,
+            x21 = x2 - x1,
+            y21 = y2 - y1,
+            x01 = x0 - x1,
+            y01 = y0 - y1,
+            l01_2 = x01 * x01 + y01 * y01;
+
+    // Is the radius negative? Error.
+    if (r < 0) throw std::runtime_error("negative radius: " + detail::to_str(r));
+
+    // Is this path empty? Move to (x1,y1).
+    if ( std::isnan( this->_x1 ) == true) {
+        this->put(detail::Chars() << 'M' << (this->_xm = this->_x1 = x1) << ',' << (this->_ym = this->_y1 = y1));
+    }
+
+    // Or, is (x1,y1) coincident with (x0,y0)? Do nothing.
+    else if (!(l01_2 > detail::epsilon));
+
+    // Or, are (x0,y0), (x1,y1) and (x2,y2) collinear?
+    // Equivalently, is (x1,y1) coincident with (x2,y2)?
+    // Or, is the radius zero? Line to (x1,y1).
+    else if (!(std::abs(y01 * x21 - y21 * x01) > detail::epsilon) || !r) {
+        this->put(detail::Chars() << 'L' << (this->_x1 = x1) << ',' << (this->_y1 = y1));
+    }
+
+    // Otherwise, draw an arc!
+    else {
+        const number_t
+                x20 = x2 - x0,
+                y20 = y2 - y0,
+                l21_2 = x21 * x21 + y21 * y21,
+                l20_2 = x20 * x20 + y20 * y20,
+                l21 = std::sqrt(l21_2),
+                l01 = std::sqrt(l01_2),
+                l = r * std::tan((detail::pi - std::acos((l21_2 + l01_2 - l20_2) / (2 * l21 * l01))) / 2),
+                t01 = l / l01,
+                t21 = l / l21;
+
+        // If the start tangent is not coincident with (x0,y0), line to.
+        if (std::abs(t01 - 1) > detail::epsilon) {
+            this->put(detail::Chars() << 'L' << (x1 + t01 * x01) << ',' << (y1 + t01 * y01));
+        }
+
+        this->put(detail::Chars() << 'A' << r << ',' << r << ",0,0," << (int)(y01 * x20 > x01 * y20) << ',' << (this->_x1 = x1 + t21 * x21) << ',' << (this->_y1 = y1 + t21 * y21));
+    }
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::arc(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t r, PathInterface::number_t a0, PathInterface::number_t a1, bool ccw)
+{
+    const number_t
+            dx = r * std::cos(a0),
+            dy = r * std::sin(a0),
+            x0 = x + dx,
+            y0 = y + dy,
+            cw = !ccw;
+   number_t
+            da = ccw ? a0 - a1 : a1 - a0;
+
+    // Is the radius negative? Error.
+    if (r < 0) throw std::runtime_error("negative radius: " + detail::to_str(r));
+
+    // Is this path empty? Move to (x0,y0).
+    if ( std::isnan( this->_x1 ) == true ) {
+        this->put(detail::Chars() << 'M' << (this->_xm = x0) << ',' << (this->_ym = y0));
+    }
+
+    // Or, is (x0,y0) not coincident with the previous point? Line to (x0,y0).
+    else if ( std::abs(this->_x1 - x0) > detail::epsilon || std::abs(this->_y1 - y0) > detail::epsilon) {
+        this->put(detail::Chars() << 'L' << x0 << ',' << y0);
+    }
+
+    // Is this arc empty? We’re done.
+    if (!r) return;
+
+    // Does the angle go the wrong way? Flip the direction.
+    if (da < 0) da = std::fmod(da , detail::tau) + detail::tau;
+
+    // Is this a complete circle? Draw two arcs to complete the circle.
+    if (da > detail::tauEpsilon) {
+        this->put(detail::Chars() << 'A' << r << ',' << r << ",0,1," << cw << ',' << (x - dx) << ',' << (y - dy) << 'A' << r << ',' << r << ",0,1," << cw << ',' << (this->_x1 = x0) << ',' << (this->_y1 = y0));
+    }
+
+    // Is this arc non-empty? Draw an arc!
+    else if (da > detail::epsilon) {
+        this->put(detail::Chars() << 'A' << r << ',' << r << ",0," << (int)(da >= detail::pi) << ',' << cw << ',' << (this->_x1 = x + r * std::cos(a1)) << ',' << (this->_y1 = y + r * std::sin(a1)));
+    }
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::rect(PathInterface::number_t x, PathInterface::number_t y, PathInterface::number_t w, PathInterface::number_t h)
+{
+    this->put(detail::Chars() << 'M' << (this->_x0 = this->_x1 = x) << ',' << (this->_y0 = this->_y1 = +y) << 'h' << w << 'v' << h << 'h' << -w << 'Z');
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::continueFrom(const BasicPath& other)
+{
+    // Where other's data leaves an SVG reader: its subpath start is its last
+    // M, explicit or written by arc()/arcTo(); after a Z it is also the
+    // current point, which other keeps unset like d3.
+    const number_t
+            x0 = std::isnan(other._x0) ? other._xm : other._x0,
+            y0 = std::isnan(other._x0) ? other._ym : other._y0;
+
+    if (std::isnan(x0)) return;
+    this->_x0 = x0;
+    this->_y0 = y0;
+    this->_x1 = std::isnan(other._x1) ? x0 : other._x1;
+    this->_y1 = std::isnan(other._x1) ? y0 : other._y1;
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::append(const BasicPath& other)
+{
+    using detail::appendBuffer;
+    appendBuffer(this->_, other._);
+    this->continueFrom(other);
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::append(BasicPath&& other)
+{
+    if (&other == this) {
+        this->append(static_cast<const BasicPath&>(other));
+        return;
+    }
+
+    if (this->_.size() == 0) this->_ = std::move(other._);
+    else {
+        using detail::appendBuffer;
+        appendBuffer(this->_, other._);
+    }
+    this->continueFrom(other);
+    other.clear();
+}
+
+template <typename Buffer>
+FrozenPath BasicPath<Buffer>::freeze()
+{
+    using detail::takeBuffer;
+    FrozenPath frozen( takeBuffer(this->_) );
+    this->clear();
+    return frozen;
+}
+
+template <typename Buffer>
+void BasicPath<Buffer>::clear()
+{
+    this->_x0 = this->_y0 = this->_x1 = this->_y1 = this->_xm = this->_ym = detail::NULL_NUMBER;
+    this->_.clear();
+}
+
+template <typename Buffer>
+std::string BasicPath<Buffer>::toString() const
+{
+    using detail::bufferString;
+    return bufferString(this->_);
+}
+
+} // namespace d3_path
+
+#endif // D3__PATH__DETAIL__BASIC_PATH_HPP
@@ -0,0 +1,24 @@
+#ifndef D3__PATH__DETAIL__CONSTANTS_HPP
+#define D3__PATH__DETAIL__CONSTANTS_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <limits> // for std::numeric_limits<T>::quiet_NaN()
+#include <cmath>  // for M_PI
+
+namespace d3_path {
+namespace detail {
+
+// d3's values, shared by Path and the other PathInterface implementations.
+
+constexpr PathInterface::number_t NULL_NUMBER = std::numeric_limits<PathInterface::number_t>::quiet_NaN();
+
+constexpr PathInterface::number_t pi = M_PI;
+constexpr PathInterface::number_t tau = 2 * pi;
+constexpr PathInterface::number_t epsilon = 1e-6;
+constexpr PathInterface::number_t tauEpsilon = tau - epsilon;
+
+} // namespace detail
+} // namespace d3_path
+
+#endif // D3__PATH__DETAIL__CONSTANTS_HPP
@@ -0,0 +1,60 @@
+#ifndef D3__PATH__DETAIL__FIXED_HPP
+#define D3__PATH__DETAIL__FIXED_HPP
+
+#include "d3_path/PathInterface.hpp"
+
+#include <string>
+#include <cmath> // for std::llround(), std::isfinite(), std::abs()
+
+namespace d3_path {
+namespace detail {
+
+// Largest `precision` accepted by appendFixed().
+constexpr int MAX_FIXED_PRECISION = 6;
+
+// Appends `value` with at most `precision` (0 … MAX_FIXED_PRECISION) decimals,
+// trailing zeros and "-0" dropped, for document backends (PDF, PostScript).
+// Non-finite values are written as 0 and magnitudes are clamped to 1e9.
+inline void appendFixed(std::string& out, PathInterface::number_t value, int precision)
+{
+    static const long long scales[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+    const PathInterface::number_t max = 1e9;
+
+    if (!std::isfinite(value)) value = 0;
+    if (std::abs(value) > max) value = (value < 0) ? -max : max;
+
+    const long long
+            scale = scales[precision],
+            v = std::llround(value * scale);
+    unsigned long long
+            u = static_cast<unsigned long long>(v < 0 ? -v : v),
+            integer = u / scale,
+            fraction = u % scale;
+
+    // Right to left: fraction without trailing zeros, point, integer, sign.
+    char digits[32];
+    char* const end = digits + sizeof(digits);
+    char* p = end;
+
+    if (fraction != 0) {
+        int n = precision;
+        while (fraction % 10 == 0) {
+            fraction /= 10;
+            --n;
+        }
+        for (; n > 0; --n, fraction /= 10) *--p = static_cast<char>('0' + fraction % 10);
+        *--p = '.';
+    }
+    do {
+        *--p = static_cast<char>('0' + integer % 10);
+        integer /= 10;
+    } while (integer != 0);
+    if (v < 0) *--p = '-';
+
+    out.append(p, end - p);
+}
+
+} // namespace detail
+} // namespace d3_path
+
+#endif // D3__PATH__DETAIL__FIXED_HPP
@@ -0,0 +1,33 @@
+#ifndef D3__PATH__DETAIL__PARALLEL_HPP
+#define D3__PATH__DETAIL__PARALLEL_HPP
+
+#include <thread>
+#include <vector>
+
+namespace d3_path {
+namespace detail {
+
+// Runs `f(k)` for k in [0, count): k = 0 on the calling thread, the others on their own threads.
+template <typename F>
+inline void parallelFor(unsigned count, F f)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(count > 0 ? count - 1 : 0);
+    for (unsigned k = 1; k < count; ++k) {
+        workers.emplace_back(f, k);
+    }
+    if (count > 0) f(0u);
+    for (std::thread& worker : workers) worker.join();
+}
+
+// 0 means "one per core".
+inline unsigned resolveThreads(unsigned threads)
+{
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    return (threads == 0) ? 1 : threads;
+}
+
+} // namespace detail
+} // namespace d3_path
+
+#endif // D3__PATH__DETAIL__PARALLEL_HPP
@@ -0,0 +1,21 @@
+#ifndef D3__PATH__DETAIL__TO_STR_HPP
+#define D3__PATH__DETAIL__TO_STR_HPP
+
+#include <string>
+#include <sstream>
+
+namespace d3_path {
+namespace detail {
+
+// For error messages.
+template <typename T>
+inline std::string to_str(const T& value) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+} // namespace detail
+} // namespace d3_path
+
+#endif // D3__PATH__DETAIL__TO_STR_HPP
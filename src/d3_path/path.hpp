@@ -2,6 +2,7 @@
 #define D3_PATH_INDEX_HPP
 
 #include "d3_path/Path.hpp"
+#include "d3_path/PathPool.hpp"
 
 namespace d3_path {
 
@@ -9,6 +10,30 @@ inline d3_path::Path path() {
     return d3_path::Path();
 }
 
+/**
+ * A cleared path from the calling thread's pool, keeping the capacity of
+ * its previous use; it goes back when the handle is destroyed.
+ */
+inline d3_path::PooledPath pooledPath() {
+    return d3_path::PathPool::local().acquire();
+}
+
+/**
+ * A path whose data is allocated from `arena`; it must not outlive it.
+ */
+inline d3_path::ArenaPath path(d3_path::Arena& arena) {
+    return d3_path::ArenaPath(d3_path::ArenaString(d3_path::ArenaAllocator<char>(arena)));
+}
+
+#ifdef D3_PATH_HAS_PMR
+/**
+ * A path whose data is allocated from `resource`, e.g. a std::pmr::monotonic_buffer_resource.
+ */
+inline d3_path::pmr::Path path(std::pmr::memory_resource* resource) {
+    return d3_path::pmr::Path(std::pmr::string(resource));
+}
+#endif
+
 } // namespace d3_path
 
 #endif // D3_PATH_INDEX_HPP
@@ -0,0 +1,10 @@
+# Cairo backend (CairoPath -> cairo_t). Include after d3_path.pri.
+
+CONFIG += link_pkgconfig
+PKGCONFIG += cairo
+
+SOURCES += \
+    $$PWD/d3_path/CairoPath.cpp
+
+HEADERS += \
+    $$PWD/d3_path/CairoPath.hpp
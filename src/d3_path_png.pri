@@ -0,0 +1,9 @@
+# PNG encoder (encodePng, zlib). Include after d3_path.pri.
+
+LIBS += -lz
+
+SOURCES += \
+    $$PWD/d3_path/Png.cpp
+
+HEADERS += \
+    $$PWD/d3_path/Png.hpp
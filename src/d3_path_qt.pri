@@ -0,0 +1,10 @@
+# Qt backend (QtPath -> QPainterPath). Include after d3_path.pri.
+
+CONFIG += qt
+QT += gui
+
+SOURCES += \
+    $$PWD/d3_path/QtPath.cpp
+
+HEADERS += \
+    $$PWD/d3_path/QtPath.hpp
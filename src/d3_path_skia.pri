@@ -0,0 +1,17 @@
+# Skia backend (SkiaPath -> SkPath). Include after d3_path.pri.
+# SKIA_DIR (qmake variable or environment) points at a Skia checkout built into out/Release.
+
+isEmpty(SKIA_DIR): SKIA_DIR = $$(SKIA_DIR)
+isEmpty(SKIA_DIR): error("d3_path_skia.pri: set SKIA_DIR to the Skia checkout")
+
+# Skia's headers need C++17.
+CONFIG += c++17
+
+INCLUDEPATH += $$SKIA_DIR
+LIBS += -L$$SKIA_DIR/out/Release -lskia
+
+SOURCES += \
+    $$PWD/d3_path/SkiaPath.cpp
+
+HEADERS += \
+    $$PWD/d3_path/SkiaPath.hpp
@@ -0,0 +1,54 @@
+// Replays paths encoded by d3_path::encodeCommands() (an ArrayBuffer) or
+// d3_path::encodeCommandsJson() (an array of numbers) on a canvas 2D context,
+// or on anything else with the CanvasPathMethods (Path2D, d3.path()).
+(function(root) {
+  "use strict";
+
+  // Calls the method for opcode `op` with the arguments at args[i…];
+  // returns the index of the next argument.
+  function step(context, op, args, i) {
+    switch (op) {
+      case 0: context.moveTo(args[i], args[i + 1]); return i + 2;
+      case 1: context.closePath(); return i;
+      case 2: context.lineTo(args[i], args[i + 1]); return i + 2;
+      case 3: context.quadraticCurveTo(args[i], args[i + 1], args[i + 2], args[i + 3]); return i + 4;
+      case 4: context.bezierCurveTo(args[i], args[i + 1], args[i + 2], args[i + 3], args[i + 4], args[i + 5]); return i + 6;
+      case 5: context.arcTo(args[i], args[i + 1], args[i + 2], args[i + 3], args[i + 4]); return i + 5;
+      case 6: context.arc(args[i], args[i + 1], args[i + 2], args[i + 3], args[i + 4], args[i + 5] !== 0); return i + 6;
+      case 7: context.rect(args[i], args[i + 1], args[i + 2], args[i + 3]); return i + 4;
+    }
+    throw new Error("invalid command: " + op);
+  }
+
+  // [op, args…, op, args…]
+  function replayArray(array, context) {
+    for (var i = 0, n = array.length; i < n;) {
+      i = step(context, array[i], array, i + 1);
+    }
+  }
+
+  // "d3pc", u32 commands, u32 numbers, u8 opcodes (padded to 4), f32 arguments.
+  // The typed arrays view the buffer in place, which assumes a little-endian host.
+  function replayBuffer(buffer, context) {
+    var view = new DataView(buffer);
+    if (buffer.byteLength < 12 || view.getUint32(0, false) !== 0x64337063) {
+      throw new Error("invalid command data: missing header");
+    }
+    var commands = view.getUint32(4, true),
+        numbers = view.getUint32(8, true),
+        ops = new Uint8Array(buffer, 12, commands),
+        args = new Float32Array(buffer, 12 + ((commands + 3) & ~3), numbers);
+    for (var k = 0, i = 0; k < commands; ++k) {
+      i = step(context, ops[k], args, i);
+    }
+  }
+
+  function replay(data, context) {
+    if (data instanceof ArrayBuffer) replayBuffer(data, context);
+    else replayArray(data, context);
+  }
+
+  var exports = {replay: replay, replayArray: replayArray, replayBuffer: replayBuffer};
+  if (typeof module === "object" && module.exports) module.exports = exports;
+  else root.d3PathReplay = exports;
+})(this);
@@ -0,0 +1,120 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/Arena.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+
+#include <cstdint> // for std::uintptr_t
+#include <vector>
+#include <algorithm> // for std::fill()
+
+
+namespace {
+
+void draw(d3_path::PathInterface& p) {
+    p.moveTo(150, 100); p.lineTo(200, 100);
+    p.quadraticCurveTo(100, 50, 200, 100);
+    p.bezierCurveTo(100, 50, 0, 24, 200, 100);
+    p.arcTo(270, 39, 163, 100, 53);
+    p.arc(100, 100, 50, 0, M_PI / 2, true);
+    p.closePath();
+    p.rect(100, 200, 50, 25);
+}
+
+} // namespace
+
+TEST_CASE("arena.allocate(size, align) returns aligned, distinct memory", "[Arena]") {
+    d3_path::Arena arena(256);
+
+    char* a = static_cast<char*>(arena.allocate(3, 1));
+    double* b = static_cast<double*>(arena.allocate(sizeof(double), alignof(double)));
+    REQUIRE( reinterpret_cast<std::uintptr_t>(b) % alignof(double) == 0 );
+    REQUIRE( reinterpret_cast<char*>(b) >= a + 3 );
+
+    // Larger than a block: a block of its own.
+    char* big = static_cast<char*>(arena.allocate(1000, 16));
+    REQUIRE( reinterpret_cast<std::uintptr_t>(big) % 16 == 0 );
+    big[999] = 1;
+
+    REQUIRE( arena.allocated() == 3 + sizeof(double) + 1000 );
+    arena.release();
+    REQUIRE( arena.allocated() == 0 );
+}
+
+TEST_CASE("arena.allocate(size, align) starts a block when aligning steps past the end", "[Arena]") {
+    // Fills the 1001-byte block exactly; aligning the cursor to 8 then
+    // lands past its end.
+    d3_path::Arena arena(1001);
+    char* a = static_cast<char*>(arena.allocate(1001, 1));
+    char* b = static_cast<char*>(arena.allocate(8, 8));
+
+    REQUIRE( reinterpret_cast<std::uintptr_t>(b) % 8 == 0 );
+    REQUIRE( (b + 8 <= a || b >= a + 1001 + 8) );
+    std::fill(b, b + 8, 1);
+
+    // Same with an exactly filled one-off block.
+    d3_path::Arena small(16);
+    char* c = static_cast<char*>(small.allocate(101, 1));
+    char* d = static_cast<char*>(small.allocate(1, 1));
+    char* e = static_cast<char*>(small.allocate(8, 8));
+    REQUIRE( reinterpret_cast<std::uintptr_t>(e) % 8 == 0 );
+    REQUIRE( (e + 8 <= c || e >= c + 102 + 8) );
+    std::fill(e, e + 8, 1);
+    (void)d;
+
+    REQUIRE( arena.allocated() == 1001 + 8 );
+}
+
+TEST_CASE("path(arena) serializes like path(), into the arena", "[Arena]") {
+    d3_path::Arena arena;
+    auto expected = d3_path::path();
+    draw(expected);
+
+    auto p = d3_path::path(arena);
+    draw(p);
+    REQUIRE( p.toString() == expected.toString() );
+    REQUIRE( p.buffer().get_allocator().arena() == &arena );
+    REQUIRE( arena.allocated() >= p.buffer().size() );
+}
+
+TEST_CASE("ArenaPath without an arena uses the heap", "[Arena]") {
+    auto expected = d3_path::path();
+    draw(expected);
+
+    d3_path::ArenaPath p;
+    draw(p);
+    REQUIRE( p.buffer().get_allocator().arena() == nullptr );
+    REQUIRE( p.toString() == expected.toString() );
+}
+
+TEST_CASE("RecordedPath(arena) records into the arena", "[Arena]") {
+    d3_path::Arena arena;
+    d3_path::RecordedPath recorded(arena);
+    draw(recorded);
+
+    auto expected = d3_path::path();
+    draw(expected);
+    REQUIRE( recorded.toString() == expected.toString() );
+    REQUIRE( arena.allocated() >= recorded.numbers().size() * sizeof(double) );
+
+    // Copies draw from the same arena.
+    std::vector<d3_path::RecordedPath> copies(3, recorded);
+    REQUIRE( copies.back().numbers().get_allocator().arena() == &arena );
+}
+
+#ifdef D3_PATH_HAS_PMR
+TEST_CASE("path(resource) serializes like path(), into the memory resource", "[Arena]") {
+    char storage[4096];
+    std::pmr::monotonic_buffer_resource resource(storage, sizeof(storage), std::pmr::null_memory_resource());
+
+    auto expected = d3_path::path();
+    draw(expected);
+
+    auto p = d3_path::path(&resource);
+    draw(p);
+    REQUIRE( p.toString() == expected.toString() );
+    REQUIRE( p.buffer().data() >= storage );
+    REQUIRE( p.buffer().data() < storage + sizeof(storage) );
+}
+#endif
@@ -0,0 +1,157 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/CairoPath.hpp"
+#include "../src/d3_path/PathFlattener.hpp"
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+
+namespace {
+
+using Draw = std::function<void(d3_path::PathInterface&)>;
+
+// Owns a small ARGB32 image surface and its context.
+struct Context {
+    cairo_surface_t* surface;
+    cairo_t*         cr;
+
+    Context(int width = 200, int height = 200)
+        : surface( cairo_image_surface_create(CAIRO_FORMAT_ARGB32, width, height) )
+        , cr( cairo_create(surface) )
+    { }
+
+    ~Context() {
+        cairo_destroy(cr);
+        cairo_surface_destroy(surface);
+    }
+
+    void currentPoint(double& x, double& y) const { cairo_get_current_point(cr, &x, &y); }
+
+    int elements() const {
+        cairo_path_t* path = cairo_copy_path(cr);
+        int count = 0;
+        for (int i = 0; i < path->num_data; i += path->data[i].header.length) ++count;
+        cairo_path_destroy(path);
+        return count;
+    }
+};
+
+// Current point after `draw`, from a flattener replaying the same calls.
+void endPoint(const Draw& draw, double& x, double& y)
+{
+    d3_path::PathFlattener f;
+    draw(f);
+    x = f.points().back().x;
+    y = f.points().back().y;
+}
+
+} // namespace
+
+
+TEST_CASE("CairoPath builds lines and closed subpaths") {
+    Context c;
+    d3_path::CairoPath p(c.cr);
+    p.moveTo(150, 50); p.lineTo(200, 100); p.lineTo(100, 100); p.closePath();
+
+    // move_to, 2 × line_to, close_path and the move_to cairo appends after a close.
+    REQUIRE( c.elements() == 5 );
+    double x, y;
+    c.currentPoint(x, y);
+    REQUIRE( x == 150 );
+    REQUIRE( y == 50 );
+    REQUIRE( p.toString().empty() );
+}
+
+TEST_CASE("CairoPath maps arc onto cairo_arc / cairo_arc_negative") {
+    for (const bool ccw : { false, true }) {
+        const Draw draw = [ccw](d3_path::PathInterface& p) { p.moveTo(150, 100); p.arc(100, 100, 50, 0, M_PI / 2, ccw); };
+        Context c;
+        d3_path::CairoPath p(c.cr);
+        draw(p);
+
+        double x, y, ex, ey;
+        c.currentPoint(x, y);
+        endPoint(draw, ex, ey);
+        REQUIRE( std::abs(x - 100) < 1e-6 );
+        REQUIRE( std::abs(y - 150) < 1e-6 );
+        REQUIRE( std::abs(x - ex) < 1e-6 );
+        REQUIRE( std::abs(y - ey) < 1e-6 );
+
+        // Clockwise stays in the bottom-right quadrant; counter-clockwise goes round the top.
+        double x1, y1, x2, y2;
+        cairo_path_extents(c.cr, &x1, &y1, &x2, &y2);
+        REQUIRE( (y1 < 51) == ccw );
+    }
+}
+
+TEST_CASE("CairoPath draws full circles") {
+    Context c;
+    d3_path::CairoPath p(c.cr);
+    p.moveTo(150, 100); p.arc(100, 100, 50, 0, 2 * M_PI);
+    double x1, y1, x2, y2;
+    cairo_path_extents(c.cr, &x1, &y1, &x2, &y2);
+    REQUIRE( std::abs(x1 - 50) < 1e-3 );
+    REQUIRE( std::abs(x2 - 150) < 1e-3 );
+}
+
+TEST_CASE("CairoPath resolves arcTo as Path does") {
+    const Draw draw = [](d3_path::PathInterface& p) { p.moveTo(270, 182); p.arcTo(270, 39, 163, 100, 53); };
+    Context c;
+    d3_path::CairoPath p(c.cr);
+    draw(p);
+
+    double x, y, ex, ey;
+    c.currentPoint(x, y);
+    endPoint(draw, ex, ey);
+    REQUIRE( std::abs(x - ex) < 1e-6 );
+    REQUIRE( std::abs(y - ey) < 1e-6 );
+}
+
+TEST_CASE("CairoPath fills like the built-in rasterizer") {
+    const Draw draw = [](d3_path::PathInterface& p) {
+        p.moveTo(20, 180); p.bezierCurveTo(60, 10, 120, 250, 180, 40);
+        p.arcTo(190, 190, 20, 190, 30); p.closePath();
+        p.moveTo(140, 100); p.arc(100, 100, 35, 0, 2 * M_PI, true);
+        p.rect(150, 150, 30, -20);
+        p.moveTo(10, 10); p.quadraticCurveTo(60, 0, 40, 50);
+    };
+
+    Context c;
+    d3_path::CairoPath p(c.cr);
+    draw(p);
+    cairo_set_source_rgba(c.cr, 0, 0, 0, 1);
+    cairo_fill(c.cr);
+    p.clear();
+    cairo_surface_flush(c.surface);
+
+    d3_path::Rasterizer r;
+    draw(r);
+    d3_path::Canvas canvas(200, 200);
+    r.fill(canvas, d3_path::Color{0, 0, 0, 255}); // cairo's default fill rule is winding
+
+    const unsigned char* data = cairo_image_surface_get_data(c.surface);
+    const int stride = cairo_image_surface_get_stride(c.surface);
+    double cairo = 0, ours = 0;
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            const std::uint32_t pixel = *reinterpret_cast<const std::uint32_t*>(data + y * stride + 4 * x);
+            cairo += (pixel >> 24) / 255.0;
+            ours += canvas.pixel(x, y).a / 255.0;
+        }
+    }
+    REQUIRE( std::abs(cairo / ours - 1) < 0.01 );
+}
+
+TEST_CASE("CairoPath.clear() starts a new path") {
+    Context c;
+    d3_path::CairoPath p(c.cr);
+    p.moveTo(0, 0); p.lineTo(10, 10);
+    p.clear();
+    REQUIRE( c.elements() == 0 );
+    p.lineTo(5, 5);
+    REQUIRE( c.elements() == 1 );
+}
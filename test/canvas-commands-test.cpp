@@ -0,0 +1,108 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/CanvasCommands.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+void draw(d3_path::PathInterface& p) {
+    p.moveTo(150, 100); p.lineTo(200, 100);
+    p.quadraticCurveTo(100, 50, 200, 100);
+    p.bezierCurveTo(100, 50, 0, 24, 200, 100);
+    p.arcTo(270, 39, 163, 100, 53);
+    p.arc(100, 100, 50, 0, 1.5, true);
+    p.closePath();
+    p.rect(100, 200, 50, 25);
+}
+
+} // namespace
+
+
+TEST_CASE("encodeCommands() writes a header, padded opcodes and float arguments") {
+    d3_path::RecordedPath r;
+    r.moveTo(1, 2);
+    r.closePath();
+    r.lineTo(0.5, -1);
+
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommands(r, sink);
+
+    REQUIRE(out.size() == 12 + 4 + 4 * 4);
+    REQUIRE(out.compare(0, 12, std::string("d3pc\3\0\0\0\4\0\0\0", 12)) == 0);
+    REQUIRE(out.compare(12, 4, std::string("\0\1\2\0", 4)) == 0);
+    REQUIRE(out.compare(16, 4, std::string("\0\0\x80\x3f", 4)) == 0); // 1.0f
+    REQUIRE(out.compare(28, 4, std::string("\0\0\x80\xbf", 4)) == 0); // -1.0f
+}
+
+TEST_CASE("decodeCommands() round-trips encodeCommands()") {
+    d3_path::RecordedPath r; draw(r);
+
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommands(r, sink);
+
+    const d3_path::RecordedPath decoded = d3_path::decodeCommands(out.data(), out.size());
+    REQUIRE(decoded.commands() == r.commands());
+    REQUIRE(decoded.numbers().size() == r.numbers().size());
+    for (std::size_t i = 0; i < r.numbers().size(); ++i) {
+        REQUIRE(decoded.numbers()[i] == Approx(r.numbers()[i]).epsilon(1e-7));
+    }
+}
+
+TEST_CASE("encodeCommands() writes an empty path as a bare header") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommands(d3_path::RecordedPath(), sink);
+
+    REQUIRE(out.size() == 12);
+    REQUIRE(d3_path::decodeCommands(out.data(), out.size()).empty());
+}
+
+TEST_CASE("decodeCommands() throws on malformed input") {
+    d3_path::RecordedPath r; draw(r);
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommands(r, sink);
+
+    REQUIRE_THROWS_AS(d3_path::decodeCommands(out.data(), 8), std::runtime_error);
+    REQUIRE_THROWS_AS(d3_path::decodeCommands(out.data(), out.size() - 4), std::runtime_error);
+
+    std::string bad = out;
+    bad[0] = 'x';
+    REQUIRE_THROWS_AS(d3_path::decodeCommands(bad.data(), bad.size()), std::runtime_error);
+
+    bad = out;
+    bad[12] = 42; // unknown opcode
+    REQUIRE_THROWS_AS(d3_path::decodeCommands(bad.data(), bad.size()), std::runtime_error);
+
+    bad = out;
+    bad[13] = static_cast<char>(d3_path::RecordedPath::Command::Rect); // arguments no longer add up
+    REQUIRE_THROWS_AS(d3_path::decodeCommands(bad.data(), bad.size()), std::runtime_error);
+}
+
+TEST_CASE("encodeCommandsJson() writes opcodes followed by their arguments") {
+    d3_path::RecordedPath r;
+    r.moveTo(10, 20);
+    r.lineTo(30.25, -40.0004);
+    r.closePath();
+    r.arc(1, 2, 3, 0, 1.23456, true);
+
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommandsJson(r, sink);
+
+    REQUIRE(out == "[0,10,20,2,30.25,-40,1,6,1,2,3,0,1.235,1]");
+}
+
+TEST_CASE("encodeCommandsJson() writes an empty path as an empty array") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeCommandsJson(d3_path::RecordedPath(), sink, 2);
+
+    REQUIRE(out == "[]");
+}
@@ -6,10 +6,56 @@ CONFIG -= qt
 INCLUDEPATH += $$PWD
 
 include($$PWD/../src/d3_path.pri)
+include($$PWD/../src/d3_path_png.pri)
 
 SOURCES += \
-    path-test.cpp
+    path-test.cpp \
+    path-simplifier-test.cpp \
+    decimation-test.cpp \
+    path-transform-test.cpp \
+    path-quantizer-test.cpp \
+    recorded-path-test.cpp \
+    shape-dictionary-test.cpp \
+    path-flattener-test.cpp \
+    rasterizer-test.cpp \
+    qoi-test.cpp \
+    png-test.cpp \
+    path-parser-test.cpp \
+    pdf-path-test.cpp \
+    eps-path-test.cpp \
+    canvas-commands-test.cpp \
+    tessellator-test.cpp \
+    stroker-test.cpp \
+    path-boolean-test.cpp \
+    tee-path-test.cpp \
+    arena-test.cpp \
+    path-pool-test.cpp \
+    rope-buffer-test.cpp \
+    path-allocation-test.cpp \
+    frozen-path-test.cpp \
+    inline-buffer-test.cpp
 
 HEADERS += \
     _regex_replace.hpp \
     pathEqual.hpp
+
+# Memory-mapped output (mmap)
+unix {
+    SOURCES += mapped-file-test.cpp
+}
+
+# Optional backends: qmake CONFIG+=d3_path_qt CONFIG+=d3_path_skia SKIA_DIR=… CONFIG+=d3_path_cairo
+d3_path_qt {
+    include($$PWD/../src/d3_path_qt.pri)
+    SOURCES += qt-path-test.cpp
+}
+
+d3_path_skia {
+    include($$PWD/../src/d3_path_skia.pri)
+    SOURCES += skia-path-test.cpp
+}
+
+d3_path_cairo {
+    include($$PWD/../src/d3_path_cairo.pri)
+    SOURCES += cairo-path-test.cpp
+}
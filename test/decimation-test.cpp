@@ -0,0 +1,60 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/Decimation.hpp"
+
+#include <cmath>     // for std::sin()
+#include <algorithm> // for std::find()
+
+
+TEST_CASE("decimateM4(...) keeps the first, min, max and last point of every column") {
+    const double xs[] = { 0, 1, 2, 3,   4, 5, 6, 7 };
+    const double ys[] = { 5, 9, 1, 4,   2, 2, 8, 3 };
+    std::vector<std::size_t> indices;
+    d3_path::decimateM4(xs, ys, 8, 0, 8, 2, indices);
+    REQUIRE( indices == std::vector<std::size_t>({ 0, 1, 2, 3, 4, 6, 7 }) );
+}
+
+TEST_CASE("decimateM4(...) keeps every point when there are fewer points than columns") {
+    const double xs[] = { 0, 1, 2 };
+    const double ys[] = { 3, 1, 2 };
+    std::vector<std::size_t> indices;
+    d3_path::decimateM4(xs, ys, 3, 0, 3, 100, indices);
+    REQUIRE( indices == std::vector<std::size_t>({ 0, 1, 2 }) );
+}
+
+TEST_CASE("decimateM4(...) gives the same result with several threads") {
+    std::vector<double> xs(100000), ys(100000);
+    for (std::size_t i = 0; i < xs.size(); ++i) { xs[i] = i * 0.37; ys[i] = std::sin(i * 0.01) * (i % 7); }
+
+    std::vector<std::size_t> sequential, parallel;
+    d3_path::decimateM4(xs.data(), ys.data(), xs.size(), xs.front(), xs.back(), 1500, sequential, 1);
+    d3_path::decimateM4(xs.data(), ys.data(), xs.size(), xs.front(), xs.back(), 1500, parallel, 4);
+    REQUIRE( sequential.size() <= 4 * 1500 );
+    REQUIRE( sequential == parallel );
+}
+
+TEST_CASE("decimateLttb(...) keeps threshold points including the first and last") {
+    std::vector<double> xs(1000), ys(1000);
+    for (std::size_t i = 0; i < xs.size(); ++i) { xs[i] = i; ys[i] = (i == 500) ? 100 : 0; }
+
+    for (const unsigned threads : { 1u, 3u }) {
+        std::vector<std::size_t> indices;
+        d3_path::decimateLttb(xs.data(), ys.data(), xs.size(), 50, indices, threads);
+        REQUIRE( indices.size() == 50 );
+        REQUIRE( indices.front() == 0 );
+        REQUIRE( indices.back() == 999 );
+        REQUIRE( std::find(indices.begin(), indices.end(), 500) != indices.end() );
+    }
+}
+
+TEST_CASE("drawIndices(path, ...) draws the selected points as a polyline") {
+    const double xs[] = { 0, 1, 2, 3 };
+    const double ys[] = { 5, 9, 1, 4 };
+    auto p = d3_path::path();
+    d3_path::drawIndices(p, xs, ys, { 0, 2, 3 });
+    REQUIRE_THAT(p, pathEqual("M0,5L2,1L3,4") );
+}
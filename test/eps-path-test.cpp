@@ -0,0 +1,126 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/EpsPath.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+// Everything after the page setup, before the trailer.
+std::string body(const std::string& eps)
+{
+    const std::size_t begin = eps.find("scale\n") + 6;
+    return eps.substr(begin, eps.find("end\nshowpage") - begin);
+}
+
+} // namespace
+
+
+TEST_CASE("epsPath writes a figure with a bounding box, prolog and trailer") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 200.5, 100);
+    p.moveTo(10, 20);
+    p.lineTo(30.5, 40);
+    p.closePath();
+    p.fill();
+    p.finish();
+
+    REQUIRE(out.compare(0, 24, "%!PS-Adobe-3.0 EPSF-3.0\n") == 0);
+    REQUIRE(out.find("%%BoundingBox: 0 0 201 100 \n") != std::string::npos);
+    REQUIRE(out.find("%%HiResBoundingBox: 0 0 200.5 100 \n") != std::string::npos);
+    REQUIRE(out.find("/m /moveto load def\n") < out.find("%%EndProlog\n"));
+    REQUIRE(out.find("d3path begin\n0 100 translate 1 -1 scale\n") != std::string::npos);
+    const std::string trailer = "end\nshowpage\n%%Trailer\n%%EOF\n";
+    REQUIRE(out.compare(out.size() - trailer.size(), trailer.size(), trailer) == 0);
+    REQUIRE(body(out) == "10 20 m\n30.5 40 l\nh\nf\n");
+}
+
+TEST_CASE("epsPath.arc() uses arc and arcn with angles in degrees") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100);
+    p.arc(50, 50, 10, 0, M_PI / 2);
+    p.arc(50, 50, 20, M_PI / 2, 0, true);
+    p.stroke();
+    p.finish();
+
+    REQUIRE(body(out) == "60 50 m\n50 50 10 0 90 a\n50 70 l\n50 50 20 90 0 an\ns\n");
+}
+
+TEST_CASE("epsPath.arc() draws full circles with a single arc") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100);
+    p.moveTo(60, 50);
+    p.arc(50, 50, 10, 0, 2 * M_PI);
+    p.finish();
+
+    REQUIRE(body(out) == "60 50 m\n50 50 10 0 360 a\n");
+}
+
+TEST_CASE("epsPath.arc() writes angles with two extra decimals") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100, 1);
+    p.moveTo(60, 50);
+    p.arc(50, 50, 10, 0, 1);
+    p.finish();
+
+    REQUIRE(body(out).find("50 50 10 0 57.296 a\n") != std::string::npos);
+}
+
+TEST_CASE("epsPath converts quadratic curves and arcTo") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100);
+    p.moveTo(0, 0);
+    p.quadraticCurveTo(3, 3, 6, 0);
+    p.arcTo(10, 0, 10, 10, 5);
+    p.finish();
+
+    REQUIRE(body(out) == "0 0 m\n2 2 4 2 6 0 c\n5 0 l\n5 5 5 -90 0 a\n");
+}
+
+TEST_CASE("epsPath.rect() uses the prolog's re") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100);
+    p.rect(1, 2, 3, 4);
+    p.fill(d3_path::FillRule::EvenOdd);
+    p.finish();
+
+    REQUIRE(body(out) == "1 2 3 4 re\nef\n");
+}
+
+TEST_CASE("epsPath switches the current color only when it changes") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 100, 100);
+    p.setFillColor(1, 0.5, 0);
+    p.setLineWidth(0.5);
+    p.rect(0, 0, 1, 1);
+    p.fill();
+    p.rect(2, 0, 1, 1);
+    p.fill();
+    p.moveTo(0, 0);
+    p.lineTo(5, 5);
+    p.stroke();
+    p.finish();
+
+    REQUIRE(body(out) == "0.5 w\n0 0 1 1 re\n1 0.5 0 rg\nf\n2 0 1 1 re\nf\n0 0 m\n5 5 l\n0 0 0 rg\ns\n");
+}
+
+TEST_CASE("epsPath throws on drawing after finish()") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::EpsPath p(sink, 10, 10);
+    p.finish();
+
+    REQUIRE_THROWS_AS(p.moveTo(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(p.stroke(), std::runtime_error);
+    REQUIRE_NOTHROW(p.finish());
+}
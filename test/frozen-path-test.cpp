@@ -0,0 +1,77 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/FrozenPath.hpp"
+#include "../src/d3_path/RopePath.hpp"
+
+#include <thread>
+#include <vector>
+#include <unordered_set>
+
+
+TEST_CASE("path.freeze() hands the buffer over to a snapshot and clears the path", "[FrozenPath]") {
+    auto p = d3_path::path();
+    for (int i = 0; i < 100; ++i) p.lineTo(i, i);
+    const std::string expected = p.toString();
+    const char* data = p.buffer().data();
+
+    const d3_path::FrozenPath frozen = p.freeze();
+    REQUIRE( frozen.data() == data );
+    REQUIRE( frozen.str() == expected );
+    REQUIRE( frozen.size() == expected.size() );
+    REQUIRE( frozen.hash() == std::hash<std::string>()(expected) );
+
+    REQUIRE( p.toString() == "" );
+    p.closePath(); p.moveTo(1, 2);
+    REQUIRE( p.toString() == "M1,2" );
+}
+
+TEST_CASE("FrozenPath copies share the data", "[FrozenPath]") {
+    d3_path::RopePath p;
+    p.rect(0, 0, 10, 10);
+    const d3_path::FrozenPath frozen = p.freeze();
+    REQUIRE( frozen.str() == "M0,0h10v10h-10Z" );
+
+    const d3_path::FrozenPath copy = frozen;
+    REQUIRE( copy.data() == frozen.data() );
+    REQUIRE( frozen.useCount() == 2 );
+    REQUIRE( copy == frozen );
+}
+
+TEST_CASE("FrozenPath compares and hashes by content", "[FrozenPath]") {
+    auto a = d3_path::path(); a.rect(0, 0, 10, 10);
+    auto b = d3_path::path(); b.rect(0, 0, 10, 10);
+    auto c = d3_path::path(); c.rect(0, 0, 10, 20);
+
+    std::unordered_set<d3_path::FrozenPath> set = { a.freeze(), b.freeze(), c.freeze() };
+    REQUIRE( set.size() == 2 );
+
+    const d3_path::FrozenPath empty, alsoEmpty = d3_path::path().freeze();
+    REQUIRE( empty.empty() );
+    REQUIRE( empty.str() == "" );
+    REQUIRE( std::string(empty.data()) == "" );
+    REQUIRE( empty == alsoEmpty );
+    REQUIRE( empty.hash() == std::hash<std::string>()(std::string()) );
+}
+
+TEST_CASE("FrozenPath can be read from many threads at once", "[FrozenPath]") {
+    auto p = d3_path::path();
+    for (int i = 0; i < 1000; ++i) p.lineTo(i, i);
+    const d3_path::FrozenPath frozen = p.freeze();
+
+    std::vector<std::size_t> sums(4, 0);
+    std::vector<std::thread> readers;
+    for (std::size_t k = 0; k < sums.size(); ++k) {
+        readers.emplace_back([&frozen, &sums, k]() {
+            for (int i = 0; i < 100; ++i) {
+                const d3_path::FrozenPath mine = frozen;
+                sums[k] += mine.size() + (mine.hash() == frozen.hash());
+            }
+        });
+    }
+    for (std::thread& reader : readers) reader.join();
+
+    for (const std::size_t sum : sums) REQUIRE( sum == 100 * (frozen.size() + 1) );
+    REQUIRE( frozen.useCount() == 1 );
+}
@@ -0,0 +1,90 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/InlinePath.hpp"
+
+#include <string>
+#include <utility>
+
+
+TEST_CASE("InlineBuffer keeps small data inline and spills to the heap beyond N", "[InlineBuffer]") {
+    d3_path::InlineBuffer<16> buffer;
+    buffer.append("0123456789", 10);
+    REQUIRE( buffer.inlined() );
+    REQUIRE( buffer.capacity() == 16 );
+
+    buffer.append("abcdefghij", 10);
+    REQUIRE( !buffer.inlined() );
+    REQUIRE( std::string(buffer.data(), buffer.size()) == "0123456789abcdefghij" );
+
+    buffer.clear();
+    buffer.append("xy", 2);
+    REQUIRE( !buffer.inlined() );
+    buffer.shrink_to_fit();
+    REQUIRE( buffer.inlined() );
+    REQUIRE( std::string(buffer.data(), buffer.size()) == "xy" );
+}
+
+TEST_CASE("InlineBuffer copies and moves, inline or on the heap", "[InlineBuffer]") {
+    d3_path::InlineBuffer<8> small, large;
+    small.append("abc", 3);
+    large.append("0123456789", 10);
+
+    d3_path::InlineBuffer<8> copy(large);
+    REQUIRE( std::string(copy.data(), copy.size()) == "0123456789" );
+    REQUIRE( copy.data() != large.data() );
+
+    const char* heap = large.data();
+    d3_path::InlineBuffer<8> moved(std::move(large));
+    REQUIRE( moved.data() == heap );
+    REQUIRE( large.size() == 0 );
+    REQUIRE( large.inlined() );
+
+    moved = std::move(small);
+    REQUIRE( std::string(moved.data(), moved.size()) == "abc" );
+    REQUIRE( moved.data() == heap ); // keeps its capacity
+
+    copy = moved;
+    REQUIRE( std::string(copy.data(), copy.size()) == "abc" );
+}
+
+TEST_CASE("InlineBuffer appends its own data across a spill", "[InlineBuffer]") {
+    d3_path::InlineBuffer<8> buffer;
+    buffer.append("abcdef", 6);
+    buffer.append(buffer.data(), buffer.size());
+    REQUIRE( std::string(buffer.data(), buffer.size()) == "abcdefabcdef" );
+}
+
+TEST_CASE("InlinePath serializes like Path, without a heap buffer for a marker", "[InlineBuffer]") {
+    auto expected = d3_path::path();
+    d3_path::InlinePath<128> p;
+
+    for (d3_path::PathInterface* q : { static_cast<d3_path::PathInterface*>(&expected), static_cast<d3_path::PathInterface*>(&p) }) {
+        q->moveTo(104.5, 100);
+        q->arc(100, 100, 4.5, 0, 2 * M_PI);
+        q->closePath();
+    }
+    REQUIRE( p.toString() == expected.toString() );
+    REQUIRE( p.buffer().inlined() );
+
+    for (int i = 0; i < 100; ++i) p.lineTo(i, i);
+    REQUIRE( !p.buffer().inlined() );
+    p.clear();
+    p.shrinkToFit();
+    REQUIRE( p.buffer().inlined() );
+}
+
+TEST_CASE("InlinePath<N> works for sizes Path.cpp does not instantiate", "[InlineBuffer]") {
+    auto expected = d3_path::path();
+    d3_path::InlinePath<200> p;
+
+    for (d3_path::PathInterface* q : { static_cast<d3_path::PathInterface*>(&expected), static_cast<d3_path::PathInterface*>(&p) }) {
+        q->moveTo(10, 10);
+        q->arcTo(20, 10, 20, 20, 5);
+        q->rect(0, 0, 8, 8);
+    }
+    REQUIRE( p.toString() == expected.toString() );
+    REQUIRE( p.buffer().inlined() );
+    REQUIRE( p.capacity() == 200 );
+}
@@ -0,0 +1,125 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/MappedFile.hpp"
+#include "../src/d3_path/CanvasCommands.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h> // for ::getpid(), ::unlink(), ::sysconf()
+
+
+namespace {
+
+std::string tempName(const char* name)
+{
+    return "/tmp/d3-path-test-" + std::to_string(::getpid()) + "-" + name;
+}
+
+std::string slurp(const std::string& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    std::ostringstream out;
+    out << in.rdbuf();
+    return out.str();
+}
+
+template <typename P>
+void contour(P& p, int points)
+{
+    p.moveTo(0, 0);
+    for (int i = 1; i < points; ++i) p.lineTo(i * 0.5, i % 97);
+    p.closePath();
+}
+
+const std::size_t PAGE = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+} // namespace
+
+
+TEST_CASE("MappedPath writes the same data as Path, across extents, truncated on close", "[MappedFile]") {
+    const std::string filename = tempName("mapped-path");
+
+    d3_path::Path expected;
+    contour(expected, 5000);
+
+    {
+        d3_path::MappedPath p( d3_path::MappedFile(filename, PAGE) );
+        contour(p, 5000);
+
+        REQUIRE( p.buffer().size() == expected.toString().size() );
+        REQUIRE( p.capacity() > 2 * PAGE );
+        REQUIRE( p.capacity() % PAGE == 0 );
+        REQUIRE( p.toString() == expected.toString() );
+
+        p.buffer().close();
+        REQUIRE_FALSE( p.buffer().isOpen() );
+        REQUIRE( p.buffer().size() == 0 );
+        REQUIRE( p.toString().empty() );
+        REQUIRE( p.freeze().empty() );
+    }
+
+    REQUIRE( slurp(filename) == expected.toString() );
+    ::unlink(filename.c_str());
+}
+
+TEST_CASE("MappedFile closes on destruction, and can be written around the path", "[MappedFile]") {
+    const std::string filename = tempName("mapped-svg");
+
+    {
+        d3_path::MappedPath p( d3_path::MappedFile(filename, PAGE) );
+        p.buffer().append("<path d=\"", 9);
+        p.rect(0, 0, 10, 20);
+        p.buffer().append("\"/>", 3);
+    }
+
+    REQUIRE( slurp(filename) == "<path d=\"M0,0h10v20h-10Z\"/>" );
+    ::unlink(filename.c_str());
+}
+
+TEST_CASE("MappedFile clear() starts over, moves hand over the file", "[MappedFile]") {
+    const std::string filename = tempName("mapped-move");
+
+    d3_path::MappedFile file(filename, PAGE);
+    file.append("discarded", 9);
+    file.clear();
+    file.append("kept", 4);
+
+    d3_path::MappedFile moved(std::move(file));
+    REQUIRE_FALSE( file.isOpen() );
+    REQUIRE( std::string(moved.data(), moved.size()) == "kept" );
+
+    moved.close();
+    moved.close(); // closing twice is harmless
+    REQUIRE( slurp(filename) == "kept" );
+    ::unlink(filename.c_str());
+}
+
+TEST_CASE("MappedFile throws when it can't open the file or has none", "[MappedFile]") {
+    REQUIRE_THROWS_AS( d3_path::MappedFile("/nonexistent-dir/out.path"), std::runtime_error );
+
+    d3_path::MappedFile none;
+    REQUIRE_FALSE( none.isOpen() );
+    REQUIRE_THROWS_AS( none.append("x", 1), std::runtime_error );
+}
+
+TEST_CASE("MappedFileSink takes encoder output", "[MappedFile]") {
+    const std::string filename = tempName("mapped-sink");
+
+    d3_path::RecordedPath recorded;
+    contour(recorded, 2000);
+
+    std::string expected;
+    d3_path::StringSink strings(expected);
+    d3_path::encodeCommands(recorded, strings);
+
+    d3_path::MappedFileSink sink(filename, PAGE);
+    d3_path::encodeCommands(recorded, sink);
+    REQUIRE( sink.size() == expected.size() );
+    sink.close();
+
+    REQUIRE( slurp(filename) == expected );
+    ::unlink(filename.c_str());
+}
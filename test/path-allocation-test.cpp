@@ -0,0 +1,97 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+
+#include <new>     // for std::bad_alloc
+#include <atomic>
+#include <cstdlib> // for std::malloc(), std::free()
+#include <functional>
+
+
+// Counts every allocation of this test binary.
+namespace {
+
+std::atomic<std::size_t> allocations( 0 );
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+
+namespace {
+
+using Call = std::function<void(d3_path::PathInterface&)>;
+
+// Allocations by `repeat` calls, once `path` has grown through the same calls.
+template <typename P>
+std::size_t allocationsAfterWarmUp(P& path, const Call& call, int repeat = 1000)
+{
+    for (int i = 0; i < repeat; ++i) call(path);
+    path.clear();
+
+    const std::size_t before = allocations;
+    for (int i = 0; i < repeat; ++i) call(path);
+    return allocations - before;
+}
+
+const std::vector<std::pair<const char*, Call>>& calls()
+{
+    static const std::vector<std::pair<const char*, Call>> all = {
+        { "moveTo",           [](d3_path::PathInterface& p) { p.moveTo(150.123456, -100.5); } },
+        { "closePath",        [](d3_path::PathInterface& p) { p.closePath(); } },
+        { "lineTo",           [](d3_path::PathInterface& p) { p.lineTo(1e-7, 12345678.9); } },
+        { "quadraticCurveTo", [](d3_path::PathInterface& p) { p.quadraticCurveTo(100, 50, 200, 100); } },
+        { "bezierCurveTo",    [](d3_path::PathInterface& p) { p.bezierCurveTo(100, 50, 0, 24, 200, 100); } },
+        { "arcTo",            [](d3_path::PathInterface& p) { p.moveTo(270, 182); p.arcTo(270, 39, 163, 100, 53); } },
+        { "arc",              [](d3_path::PathInterface& p) { p.arc(100, 100, 50, 0, M_PI / 2, true); } },
+        { "arc (circle)",     [](d3_path::PathInterface& p) { p.arc(100, 100, 50, 0, 2 * M_PI); } },
+        { "rect",             [](d3_path::PathInterface& p) { p.rect(100, 200, 50, 25); } },
+    };
+    return all;
+}
+
+} // namespace
+
+TEST_CASE("path methods allocate nothing once the buffer has grown", "[allocation]") {
+    for (const auto& call : calls()) {
+        INFO( call.first );
+        auto p = d3_path::path();
+        REQUIRE( allocationsAfterWarmUp(p, call.second) == 0 );
+    }
+}
+
+TEST_CASE("recorded path methods allocate nothing once the buffers have grown", "[allocation]") {
+    for (const auto& call : calls()) {
+        INFO( call.first );
+        d3_path::RecordedPath r;
+        REQUIRE( allocationsAfterWarmUp(r, call.second) == 0 );
+    }
+}
+
+TEST_CASE("the allocation counter sees allocations", "[allocation]") {
+    const std::size_t before = allocations;
+    auto p = d3_path::path();
+    p.rect(100, 200, 50, 25); // beyond the small-string buffer
+    const std::size_t after = allocations;
+    REQUIRE( after > before );
+}
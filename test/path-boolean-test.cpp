@@ -0,0 +1,169 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathBoolean.hpp"
+#include "../src/d3_path/PathFlattener.hpp"
+
+#include <cmath>
+
+
+namespace {
+
+// Signed shoelace area of the flattened outline, positive when clockwise on screen.
+double area(const d3_path::RecordedPath& path)
+{
+    d3_path::PathFlattener flattener(0.01);
+    path.replay(flattener);
+
+    double sum = 0;
+    const auto& points = flattener.points();
+    for (const auto& contour : flattener.contours()) {
+        for (std::size_t i = contour.begin; i < contour.end; ++i) {
+            const auto& a = points[i];
+            const auto& b = points[(i + 1 < contour.end) ? i + 1 : contour.begin];
+            sum += a.x * b.y - b.x * a.y;
+        }
+    }
+    return sum / 2;
+}
+
+d3_path::RecordedPath rect(double x, double y, double w, double h)
+{
+    d3_path::RecordedPath p;
+    p.rect(x, y, w, h);
+    return p;
+}
+
+d3_path::RecordedPath circle(double cx, double cy, double r)
+{
+    d3_path::RecordedPath p;
+    p.moveTo(cx + r, cy);
+    p.arc(cx, cy, r, 0, 2 * M_PI);
+    p.closePath();
+    return p;
+}
+
+} // namespace
+
+TEST_CASE("booleanOp(a, b, Union, out) merges overlapping rectangles into one contour", "[PathBoolean]") {
+    auto p = d3_path::path();
+    d3_path::booleanOp(rect(0, 0, 20, 10), rect(10, 5, 20, 10), d3_path::BooleanOp::Union, p);
+    REQUIRE_THAT(p, pathEqual("M0,0L20,0L20,5L30,5L30,15L10,15L10,10L0,10Z"));
+}
+
+TEST_CASE("booleanOp(a, b, Intersection, out) keeps the overlap", "[PathBoolean]") {
+    auto p = d3_path::path();
+    d3_path::booleanOp(rect(0, 0, 20, 10), rect(10, 5, 20, 10), d3_path::BooleanOp::Intersection, p);
+    REQUIRE_THAT(p, pathEqual("M10,5L20,5L20,10L10,10Z"));
+}
+
+TEST_CASE("booleanOp(a, b, Difference, out) cuts b out of a, holes counterclockwise", "[PathBoolean]") {
+    auto p = d3_path::path();
+    d3_path::booleanOp(rect(0, 0, 20, 10), rect(10, 5, 20, 10), d3_path::BooleanOp::Difference, p);
+    REQUIRE_THAT(p, pathEqual("M0,0L20,0L20,5L10,5L10,10L0,10Z"));
+
+    auto q = d3_path::path();
+    d3_path::booleanOp(rect(0, 0, 30, 30), rect(10, 10, 10, 10), d3_path::BooleanOp::Difference, q);
+    REQUIRE_THAT(q, pathEqual("M0,0L30,0L30,30L0,30ZM10,10L10,20L20,20L20,10Z"));
+}
+
+TEST_CASE("booleanOp(a, b, Xor, out) keeps what is in exactly one operand", "[PathBoolean]") {
+    d3_path::RecordedPath out;
+    d3_path::booleanOp(rect(0, 0, 20, 10), rect(10, 5, 20, 10), d3_path::BooleanOp::Xor, out);
+    REQUIRE( area(out) == Approx(200 + 200 - 2 * 50) );
+}
+
+TEST_CASE("booleanOp(…) cancels shared edges of adjacent cells exactly", "[PathBoolean]") {
+    std::vector<d3_path::RecordedPath> cells;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) cells.push_back(rect(10 * i, 10 * j, 10, 10));
+    }
+
+    auto p = d3_path::path();
+    d3_path::booleanOp(cells, d3_path::BooleanOp::Union, p);
+    REQUIRE_THAT(p, pathEqual("M0,0L40,0L40,30L0,30Z"));
+}
+
+TEST_CASE("booleanOp(…) resolves self-intersections by the fill rule", "[PathBoolean]") {
+    // Pentagram: the center is inside with NonZero, a hole with EvenOdd.
+    d3_path::RecordedPath star;
+    for (int i = 0; i < 5; ++i) {
+        const double a = -M_PI / 2 + i * 4 * M_PI / 5;
+        if (i == 0) star.moveTo(50 + 40 * std::cos(a), 50 + 40 * std::sin(a));
+        else        star.lineTo(50 + 40 * std::cos(a), 50 + 40 * std::sin(a));
+    }
+    star.closePath();
+
+    const std::vector<d3_path::RecordedPath> paths = { star };
+
+    d3_path::RecordedPath nonZero, evenOdd;
+    d3_path::booleanOp(paths, d3_path::BooleanOp::Union, nonZero);
+
+    d3_path::BooleanOptions options;
+    options.rule = d3_path::FillRule::EvenOdd;
+    d3_path::booleanOp(paths, d3_path::BooleanOp::Union, evenOdd, options);
+
+    // The inner pentagon, with circumradius 40·sin(18°)/sin(126°).
+    const double
+            r = 40 * std::sin(M_PI / 10) / std::sin(7 * M_PI / 10),
+            pentagon = 5.0 / 2 * r * r * std::sin(2 * M_PI / 5);
+
+    REQUIRE( area(nonZero) - area(evenOdd) == Approx(pentagon).epsilon(1e-3) );
+    REQUIRE( area(evenOdd) > 0 );
+}
+
+TEST_CASE("booleanOp(…) flattens curves and arcs", "[PathBoolean]") {
+    d3_path::RecordedPath out;
+    d3_path::BooleanOptions options;
+    options.tolerance = 0.001;
+    d3_path::booleanOp(circle(0, 0, 10), circle(10, 0, 10), d3_path::BooleanOp::Intersection, out, options);
+
+    // Lens of two unit-distance circles: 2r²(π/3) − (√3/2)r².
+    const double lens = 100 * (2 * M_PI / 3 - std::sqrt(3.0) / 2);
+    REQUIRE( area(out) == Approx(lens).epsilon(1e-3) );
+}
+
+TEST_CASE("booleanOp(…) over many paths matches combining them one by one", "[PathBoolean]") {
+    std::vector<d3_path::RecordedPath> circles;
+    for (int i = 0; i < 9; ++i) circles.push_back(circle(7 * (i % 3), 7 * (i / 3), 5));
+
+    d3_path::RecordedPath sequential = circles.front();
+    for (std::size_t i = 1; i < circles.size(); ++i) {
+        d3_path::RecordedPath next;
+        d3_path::booleanOp(sequential, circles[i], d3_path::BooleanOp::Union, next);
+        sequential = next;
+    }
+
+    d3_path::BooleanOptions options;
+    options.threads = 3;
+    d3_path::RecordedPath tree;
+    d3_path::booleanOp(circles, d3_path::BooleanOp::Union, tree, options);
+
+    REQUIRE( area(tree) == Approx(area(sequential)).epsilon(1e-6) );
+
+    d3_path::RecordedPath again;
+    d3_path::booleanOp(circles, d3_path::BooleanOp::Union, again, options);
+    auto a = d3_path::path();
+    auto b = d3_path::path();
+    tree.replay(a);
+    again.replay(b);
+    REQUIRE( a.toString() == b.toString() );
+}
+
+TEST_CASE("booleanOp(…) with Difference subtracts all the others from the first path", "[PathBoolean]") {
+    const std::vector<d3_path::RecordedPath> paths = { rect(0, 0, 30, 10), rect(0, 0, 10, 10), rect(20, 0, 10, 10) };
+
+    auto p = d3_path::path();
+    d3_path::booleanOp(paths, d3_path::BooleanOp::Difference, p);
+    REQUIRE_THAT(p, pathEqual("M10,0L20,0L20,10L10,10Z"));
+}
+
+TEST_CASE("booleanOp(…) of nothing writes nothing", "[PathBoolean]") {
+    auto p = d3_path::path();
+    d3_path::booleanOp(std::vector<d3_path::RecordedPath>(), d3_path::BooleanOp::Union, p);
+    d3_path::booleanOp(rect(0, 0, 10, 10), rect(20, 0, 10, 10), d3_path::BooleanOp::Intersection, p);
+    REQUIRE( p.toString() == "" );
+}
@@ -0,0 +1,65 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathFlattener.hpp"
+
+#include <cmath>
+
+
+TEST_CASE("flattener keeps polylines as they are") {
+    d3_path::PathFlattener f;
+    f.moveTo(150, 50); f.lineTo(200, 100); f.lineTo(100, 100); f.closePath();
+    REQUIRE_THAT(f, pathEqual("M150,50L200,100L100,100Z") );
+    REQUIRE( f.contours().size() == 2 ); // the closed triangle, and the start of the next subpath
+    REQUIRE( f.contours()[0].closed == true );
+    REQUIRE( f.contours()[0].size() == 3 );
+}
+
+TEST_CASE("flattener starts a contour per moveTo, reusing empty ones") {
+    d3_path::PathFlattener f;
+    f.moveTo(0, 0); f.moveTo(10, 10); f.lineTo(20, 10);
+    f.moveTo(30, 30); f.lineTo(40, 40);
+    REQUIRE( f.contours().size() == 2 );
+    REQUIRE_THAT(f, pathEqual("M10,10L20,10M30,30L40,40") );
+}
+
+TEST_CASE("flattener subdivides arcs within the tolerance") {
+    d3_path::PathFlattener f(0.1);
+    f.arc(100, 100, 50, 0, 2 * M_PI);
+    const auto& points = f.points();
+    REQUIRE( points.size() > 20 );
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        const auto a = points[i], b = points[i + 1];
+        const double
+                mx = (a.x + b.x) / 2 - 100,
+                my = (a.y + b.y) / 2 - 100;
+        REQUIRE( 50 - std::sqrt(mx * mx + my * my) <= 0.1 + 1e-9 );
+        REQUIRE( std::abs(std::hypot(b.x - 100, b.y - 100) - 50) < 1e-9 );
+    }
+}
+
+TEST_CASE("flattener subdivides curves within the tolerance") {
+    d3_path::PathFlattener f(0.05);
+    f.moveTo(0, 0); f.quadraticCurveTo(50, 100, 100, 0);
+    const auto& points = f.points();
+    REQUIRE( points.back().x == 100 );
+    REQUIRE( points.back().y == 0 );
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        // The curve is y = 2x - x²/50; sample each chord's midpoint against it.
+        const double
+                x = (points[i].x + points[i + 1].x) / 2,
+                y = (points[i].y + points[i + 1].y) / 2;
+        REQUIRE( std::abs((2 * x - x * x / 50) - y) <= 0.05 + 1e-9 );
+    }
+}
+
+TEST_CASE("flattener.clear() forgets the geometry and the current point") {
+    d3_path::PathFlattener f;
+    f.moveTo(0, 0); f.lineTo(10, 10);
+    f.clear();
+    f.lineTo(5, 5); f.lineTo(6, 6);
+    REQUIRE_THAT(f, pathEqual("M5,5L6,6") );
+}
@@ -0,0 +1,82 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathParser.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+
+#include <stdexcept>
+
+
+namespace {
+
+d3_path::Path reparse(const std::string& data)
+{
+    auto p = d3_path::path();
+    d3_path::parsePath(data, p);
+    return p;
+}
+
+} // namespace
+
+
+TEST_CASE("parsePath replays Path output") {
+    auto p = d3_path::path();
+    p.moveTo(150, 50); p.lineTo(200, 100); p.quadraticCurveTo(10, 20, 30, 40);
+    p.bezierCurveTo(1, 2, 3, 4, 5, 6); p.closePath();
+    p.moveTo(100, 100); p.arc(100, 100, 50, 0, M_PI / 2); p.arcTo(270, 39, 163, 100, 53);
+    p.moveTo(300, 100); p.arc(250, 100, 50, 0, 2 * M_PI, true);
+
+    const std::string expected = p.toString();
+    REQUIRE_THAT(reparse(expected), pathEqual(expected) );
+}
+
+TEST_CASE("parsePath handles relative and shorthand commands") {
+    REQUIRE_THAT(reparse("M10,20h30v40h-30Z"), pathEqual("M10,20L40,20L40,60L10,60Z") );
+    REQUIRE_THAT(reparse("m10 20 l5 5 h10 v-5 H0 V0 z"), pathEqual("M10,20L15,25L25,25L25,20L0,20L0,0Z") );
+    REQUIRE_THAT(reparse("M0,0 10,10 m5,5 1,1"), pathEqual("M0,0L10,10M15,15L16,16") );
+    REQUIRE_THAT(reparse("M0,0C1,2,3,4,5,6S9,10,11,12"), pathEqual("M0,0C1,2,3,4,5,6C7,8,9,10,11,12") );
+    REQUIRE_THAT(reparse("M0,0Q1,2,3,4T7,8"), pathEqual("M0,0Q1,2,3,4Q5,6,7,8") );
+    REQUIRE_THAT(reparse("M0,0s1,1,2,2"), pathEqual("M0,0C0,0,1,1,2,2") );
+}
+
+TEST_CASE("parsePath reads compact numbers and flags") {
+    REQUIRE_THAT(reparse("M-1-2L.5.5L1e1,2E-1"), pathEqual("M-1,-2L0.5,0.5L10,0.2") );
+    REQUIRE_THAT(reparse("M0,0A10,10,0,0110,10"), pathEqual("M0,0A10,10,0,0,1,10,10") );
+}
+
+TEST_CASE("parsePath turns elliptical arcs into cubics") {
+    auto p = d3_path::path();
+    d3_path::parsePath("M0,0A20,10,0,0,1,40,0", p);
+    // Half an ellipse: two quarter cubics through the bottom of the ellipse, at ⟨20, -10⟩.
+    REQUIRE_THAT(p, pathEqual("M0,0C0,-5.52285,8.95431,-10,20,-10C31.0457,-10,40,-5.52285,40,0") );
+}
+
+TEST_CASE("parsePath handles degenerate arcs as SVG does") {
+    REQUIRE_THAT(reparse("M0,0A0,5,0,0,1,10,0"), pathEqual("M0,0L10,0") );
+    REQUIRE_THAT(reparse("M0,0A5,5,0,0,1,0,0"), pathEqual("M0,0") );
+
+    // Too small radii are scaled up: a half circle around the midpoint.
+    d3_path::RecordedPath r;
+    d3_path::parsePath("M0,0A1,1,0,0,1,10,0", r);
+    REQUIRE( r.commands().back() == d3_path::RecordedPath::Command::Arc );
+    const double* arc = r.numbers().data() + r.numbers().size() - 6;
+    REQUIRE( arc[0] == Approx(5) );
+    REQUIRE( arc[1] == Approx(0).margin(1e-12) );
+    REQUIRE( arc[2] == Approx(5) );
+}
+
+TEST_CASE("parsePath rejects malformed data") {
+    auto p = d3_path::path();
+    REQUIRE_THROWS_AS( d3_path::parsePath("10,10", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M10", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M0,0Z5,5", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M0,0X", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M0,0A1,1,0,2,1,5,5", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M.,0", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("Minf,0", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("Mnan,0", p), std::runtime_error );
+    REQUIRE_THROWS_AS( d3_path::parsePath("M0x10,0", p), std::runtime_error );
+}
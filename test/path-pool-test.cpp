@@ -0,0 +1,101 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathPool.hpp"
+
+#include <thread>
+
+
+TEST_CASE("pool.acquire() hands out a cleared path keeping its previous capacity", "[PathPool]") {
+    d3_path::PathPool pool;
+    std::size_t capacity = 0;
+    {
+        d3_path::PooledPath p = pool.acquire();
+        for (int i = 0; i < 100; ++i) p->lineTo(i, i);
+        capacity = p->capacity();
+    }
+    REQUIRE( pool.size() == 1 );
+
+    d3_path::PooledPath p = pool.acquire();
+    REQUIRE( pool.size() == 0 );
+    REQUIRE( p->toString() == "" );
+    REQUIRE( p->capacity() == capacity );
+
+    p->closePath(); p->arc(100, 100, 50, 0, M_PI / 2);
+    REQUIRE_THAT(*p, pathEqual("M150,100A50,50,0,0,1,100,150") );
+}
+
+TEST_CASE("pool returns trim buffers beyond options.maxCapacity", "[PathPool]") {
+    d3_path::PathPoolOptions options;
+    options.maxCapacity = 256;
+    d3_path::PathPool pool(options);
+    {
+        d3_path::PooledPath small = pool.acquire();
+        d3_path::PooledPath large = pool.acquire();
+        small->rect(0, 0, 10, 10);
+        for (int i = 0; i < 1000; ++i) large->lineTo(i, i);
+    }
+    REQUIRE( pool.size() == 2 );
+
+    d3_path::PooledPath a = pool.acquire();
+    d3_path::PooledPath b = pool.acquire();
+    REQUIRE( a->capacity() <= 256 );
+    REQUIRE( b->capacity() <= 256 );
+}
+
+TEST_CASE("pool keeps at most options.maxPooled paths", "[PathPool]") {
+    d3_path::PathPoolOptions options;
+    options.maxPooled = 2;
+    d3_path::PathPool pool(options);
+    {
+        d3_path::PooledPath a = pool.acquire(), b = pool.acquire(), c = pool.acquire();
+    }
+    REQUIRE( pool.size() == 2 );
+
+    options.maxPooled = 1;
+    pool.setOptions(options);
+    REQUIRE( pool.size() == 1 );
+    pool.clear();
+    REQUIRE( pool.size() == 0 );
+}
+
+TEST_CASE("moved-from handles return nothing", "[PathPool]") {
+    d3_path::PathPool pool;
+    {
+        d3_path::PooledPath a = pool.acquire();
+        a->moveTo(1, 2);
+        d3_path::PooledPath b = std::move(a);
+        REQUIRE_THAT(*b, pathEqual("M1,2") );
+
+        d3_path::PooledPath c = pool.acquire();
+        c = std::move(b); // c's own path goes back
+        REQUIRE( pool.size() == 1 );
+        REQUIRE_THAT(*c, pathEqual("M1,2") );
+    }
+    REQUIRE( pool.size() == 2 );
+}
+
+TEST_CASE("pooledPath() handles go back to the local pool of the destroying thread", "[PathPool]") {
+    d3_path::PathPool::local().clear();
+
+    d3_path::PooledPath p = d3_path::pooledPath();
+    p->rect(0, 0, 10, 10);
+
+    std::string seen;
+    std::size_t pooledThere = 0;
+    std::thread worker([&]() {
+        {
+            d3_path::PooledPath moved = std::move(p);
+            seen = moved->toString();
+        }
+        pooledThere = d3_path::PathPool::local().size();
+    });
+    worker.join();
+
+    REQUIRE( seen == "M0,0h10v10h-10Z" );
+    REQUIRE( pooledThere == 1 );
+    REQUIRE( d3_path::PathPool::local().size() == 0 );
+}
@@ -0,0 +1,64 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathQuantizer.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+
+
+TEST_CASE("quantizer snaps coordinates to the grid") {
+    auto p = d3_path::path();
+    d3_path::PathQuantizer q(p, 0.125);
+    q.moveTo(0.06, 1.01); q.lineTo(10.2, 3.3);
+    q.bezierCurveTo(1.01, 2.02, 3.03, 4.04, 5.05, 6.06);
+    REQUIRE_THAT(q, pathEqual("M0,1L10.25,3.25C1,2,3,4,5,6") );
+}
+
+TEST_CASE("quantizer drops lineTo commands of zero length after snapping") {
+    auto p = d3_path::path();
+    d3_path::PathQuantizer q(p, 1);
+    q.moveTo(0, 0); q.lineTo(0.2, 0.1); q.lineTo(5, 3); q.lineTo(5.3, 2.8); q.lineTo(4.9, 3.1);
+    REQUIRE_THAT(q, pathEqual("M0,0L5,3") );
+    REQUIRE( q.dropped() == 3 );
+}
+
+TEST_CASE("quantizer drops interior points of straight runs") {
+    auto p = d3_path::path();
+    d3_path::PathQuantizer q(p, 1);
+    q.moveTo(0, 0); q.lineTo(1, 1); q.lineTo(2, 2); q.lineTo(3, 3); q.lineTo(3, 5); q.lineTo(3, 9);
+    REQUIRE_THAT(q, pathEqual("M0,0L3,3L3,9") );
+}
+
+TEST_CASE("quantizer keeps the point where a straight run turns around") {
+    auto p = d3_path::path();
+    d3_path::PathQuantizer q(p, 1);
+    q.moveTo(0, 0); q.lineTo(5, 0); q.lineTo(10, 0); q.lineTo(2, 0);
+    REQUIRE_THAT(q, pathEqual("M0,0L10,0L2,0") );
+}
+
+TEST_CASE("quantizer forwards the pending point before other commands") {
+    auto p = d3_path::path();
+    d3_path::PathQuantizer q(p, 1);
+    q.moveTo(0, 0); q.lineTo(5, 0); q.lineTo(10, 0); q.closePath();
+    q.lineTo(0, 5); q.arc(100, 100, 50, 0, M_PI / 2);
+    q.rect(0.4, 0.4, 9.8, 9.8);
+    REQUIRE_THAT(q, pathEqual("M0,0L10,0ZL0,5L150,100A50,50,0,0,1,100,150M0,0h10v10h-10Z") );
+}
+
+TEST_CASE("quantizer.flush() forwards the held-back last point to a target without toString()") {
+    d3_path::RecordedPath recorded;
+    d3_path::PathQuantizer q(recorded, 1);
+    q.moveTo(0, 0); q.lineTo(5, 0); q.lineTo(10, 0);
+    REQUIRE( recorded.commands().size() == 1 );
+
+    q.flush();
+    REQUIRE( recorded.commands().size() == 2 );
+    q.flush();
+    REQUIRE( recorded.commands().size() == 2 );
+
+    auto p = d3_path::path();
+    recorded.replay(p);
+    REQUIRE_THAT(p, pathEqual("M0,0L10,0") );
+}
@@ -0,0 +1,56 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathSimplifier.hpp"
+
+
+TEST_CASE("simplifier.lineTo(x, y) drops collinear interior points") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 0.5);
+    s.moveTo(0, 0); s.lineTo(10, 0); s.lineTo(20, 0); s.lineTo(30, 0);
+    REQUIRE_THAT(s, pathEqual("M0,0L30,0") );
+    REQUIRE( s.verticesIn() == 3 );
+    REQUIRE( s.verticesOut() == 1 );
+}
+
+TEST_CASE("simplifier.lineTo(x, y) keeps points farther than the tolerance") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 0.5);
+    s.moveTo(0, 0); s.lineTo(10, 0.2); s.lineTo(20, 0); s.lineTo(20, 10); s.lineTo(20.2, 20); s.lineTo(20, 30);
+    REQUIRE_THAT(s, pathEqual("M0,0L20,0L20,30") );
+}
+
+TEST_CASE("simplifier (Visvalingam–Whyatt) drops points whose effective area is below tolerance²") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 1, d3_path::PathSimplifier::Algorithm::VisvalingamWhyatt);
+    s.moveTo(0, 0); s.lineTo(10, 0.05); s.lineTo(20, 0); s.lineTo(20, 20);
+    REQUIRE_THAT(s, pathEqual("M0,0L20,0L20,20") );
+}
+
+TEST_CASE("simplifier forwards curves, arcs and rects and simplifies runs between them") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 0.5);
+    s.moveTo(0, 0); s.lineTo(5, 0); s.lineTo(10, 0);
+    s.quadraticCurveTo(15, 5, 20, 0); s.lineTo(25, 0); s.lineTo(30, 0);
+    s.closePath(); s.lineTo(0, 5); s.lineTo(0, 10);
+    s.rect(100, 200, 50, 25);
+    REQUIRE_THAT(s, pathEqual("M0,0L10,0Q15,5,20,0L30,0ZL0,10M100,200h50v25h-50Z") );
+}
+
+TEST_CASE("simplifier never simplifies across a moveTo") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 0.5);
+    s.moveTo(0, 0); s.lineTo(10, 0);
+    s.moveTo(20, 0); s.lineTo(30, 0); s.lineTo(40, 0);
+    REQUIRE_THAT(s, pathEqual("M0,0L10,0M20,0L40,0") );
+}
+
+TEST_CASE("simplifier.lineTo(x, y) without a current point is forwarded as is") {
+    auto p = d3_path::path();
+    d3_path::PathSimplifier s(p, 0.5);
+    s.arc(100, 100, 50, 0, M_PI / 2); s.lineTo(50, 150); s.lineTo(40, 150); s.lineTo(30, 150);
+    REQUIRE_THAT(s, pathEqual("M150,100A50,50,0,0,1,100,150L50,150L30,150") );
+}
@@ -5,6 +5,11 @@
 #include "pathEqual.hpp"
 
 #include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathParser.hpp"
+
+#include <clocale> // for std::setlocale(), std::localeconv()
+#include <string>
+#include <stdexcept>
 
 
 TEST_CASE("path is an instanceof path") {
@@ -298,3 +303,111 @@ TEST_CASE("path.rect(x, y, w, h) appends M, h, v, h, and Z commands") {
     auto p = d3_path::path(); p.moveTo(150, 100), p.rect(100, 200, 50, 25);
     REQUIRE_THAT(p, pathEqual("M150,100M100,200h50v25h-50Z") );
 }
+
+namespace {
+
+// Switches LC_NUMERIC to an installed comma-decimal locale, if any, returning its name.
+const char* setCommaLocale()
+{
+    const char* const names[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "ru_RU.UTF-8", "de_DE", "fr_FR" };
+    for (const char* name : names) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr && std::string(std::localeconv()->decimal_point) != ".") return name;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("path numbers use '.' whatever the C locale's decimal point") {
+    const std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    const char* comma = setCommaLocale();
+
+    auto p = d3_path::path(); p.moveTo(1.5, 2.5), p.lineTo(-0.25, 1e-7), p.quadraticCurveTo(1.125, 0, 12345.5, 3);
+    std::setlocale(LC_NUMERIC, previous.c_str());
+
+    if (comma == nullptr) WARN( "no comma-decimal locale installed" );
+    REQUIRE( p.toString() == "M1.5,2.5L-0.25,1e-07Q1.125,0,12345.5,3" );
+}
+
+TEST_CASE("parsePath reads '.' whatever the C locale's decimal point") {
+    const std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    const char* comma = setCommaLocale();
+
+    auto p = d3_path::path();
+    std::string error;
+    try { d3_path::parsePath("M1.5,2.5L-.25,1e-7L+3.,4E1", p); }
+    catch (const std::exception& e) { error = e.what(); }
+    std::setlocale(LC_NUMERIC, previous.c_str());
+
+    if (comma == nullptr) WARN( "no comma-decimal locale installed" );
+    REQUIRE( error == "" );
+    REQUIRE( p.toString() == "M1.5,2.5L-0.25,1e-07L3,40" );
+}
+
+TEST_CASE("path.clear() empties the path and forgets the current point, keeping the capacity") {
+    auto p = d3_path::path(); p.moveTo(150, 100), p.lineTo(200, 100), p.lineTo(200, 200);
+    const std::size_t capacity = p.capacity();
+    p.clear();
+    REQUIRE( p.toString() == "" );
+    REQUIRE( p.capacity() == capacity );
+    p.closePath(); p.arc(100, 100, 50, 0, M_PI / 2);
+    REQUIRE_THAT(p, pathEqual("M150,100A50,50,0,0,1,100,150") );
+}
+
+TEST_CASE("path.append(other) splices other's commands and continues from its current point") {
+    auto a = d3_path::path(); a.moveTo(0, 0), a.lineTo(10, 0);
+    auto b = d3_path::path(); b.moveTo(20, 20), b.lineTo(30, 20);
+    a.append(b);
+    a.closePath(); a.arc(20, 20, 10, 0, M_PI / 2);
+    REQUIRE_THAT(a, pathEqual("M0,0L10,0M20,20L30,20ZL30,20A10,10,0,0,1,20,30") );
+    REQUIRE_THAT(b, pathEqual("M20,20L30,20") );
+
+    auto one = d3_path::path(); one.moveTo(0, 0), one.lineTo(10, 0), one.moveTo(20, 20), one.lineTo(30, 20);
+    one.closePath(); one.arc(20, 20, 10, 0, M_PI / 2);
+    REQUIRE_THAT(a, pathEqual(one.toString()) );
+}
+
+TEST_CASE("path.append(other) takes the subpath start from the M that other's arc() wrote") {
+    auto a = d3_path::path(); a.moveTo(0, 0), a.lineTo(10, 0);
+    auto b = d3_path::path(); b.arc(0, 0, 10, 0, M_PI / 2);
+    a.append(b);
+    a.closePath(); a.arc(10, 0, 10, M_PI, 1.5 * M_PI);
+    REQUIRE_THAT(a, pathEqual("M0,0L10,0M10,0A10,10,0,0,1,0,10ZL0,0A10,10,0,0,1,10,-10") );
+
+    auto one = d3_path::path(); one.moveTo(0, 0), one.lineTo(10, 0), one.moveTo(10, 0), one.arc(0, 0, 10, 0, M_PI / 2);
+    one.closePath(); one.arc(10, 0, 10, M_PI, 1.5 * M_PI);
+    REQUIRE_THAT(a, pathEqual(one.toString()) );
+
+    auto empty = d3_path::path();
+    a.append(empty);
+    a.lineTo(6, 6);
+    REQUIRE_THAT(a, pathEqual(one.toString() + "L6,6") );
+}
+
+TEST_CASE("path.append(other) continues from other's closed arc-only subpath") {
+    auto a = d3_path::path(); a.moveTo(0, 0), a.lineTo(10, 0);
+    auto b = d3_path::path(); b.arcTo(20, 20, 30, 20, 5), b.lineTo(30, 30), b.closePath();
+    a.append(b);
+    a.arc(30, 20, 10, M_PI, 1.5 * M_PI);
+
+    auto one = d3_path::path(); one.moveTo(0, 0), one.lineTo(10, 0), one.moveTo(20, 20), one.lineTo(30, 30), one.closePath();
+    one.arc(30, 20, 10, M_PI, 1.5 * M_PI);
+    REQUIRE_THAT(a, pathEqual(one.toString()) );
+}
+
+TEST_CASE("path.append(std::move(other)) takes other's buffer and leaves it cleared") {
+    auto b = d3_path::path(); for (int i = 0; i < 100; ++i) b.lineTo(i, i);
+    const std::string expected = b.toString();
+    const char* data = b.buffer().data();
+
+    auto a = d3_path::path();
+    a.append(std::move(b));
+    REQUIRE( a.buffer().data() == data );
+    REQUIRE( a.toString() == expected );
+    REQUIRE( b.toString() == "" );
+    b.closePath();
+    REQUIRE( b.toString() == "" );
+
+    a.append(std::move(a));
+    REQUIRE( a.toString() == expected + expected );
+}
@@ -0,0 +1,108 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/PathTransform.hpp"
+
+
+using d3_path::AffineTransform;
+
+TEST_CASE("transform.moveTo(x, y) and transform.lineTo(x, y) transform their coordinates") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::translate(10, 20) * AffineTransform::scale(2, 3));
+    t.moveTo(1, 1); t.lineTo(2, 2); t.closePath();
+    REQUIRE_THAT(t, pathEqual("M12,23L14,26Z") );
+}
+
+TEST_CASE("transform.lineTo(xs, ys, n) transforms points in batches") {
+    std::vector<double> xs(1000), ys(1000);
+    for (std::size_t i = 0; i < xs.size(); ++i) { xs[i] = i; ys[i] = -double(i); }
+
+    auto batched = d3_path::path(), single = d3_path::path();
+    const AffineTransform m = AffineTransform::rotate(0.3) * AffineTransform::translate(5, 7);
+    d3_path::PathTransform tb(batched, m), ts(single, m);
+
+    tb.lineTo(xs.data(), ys.data(), xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i) ts.lineTo(xs[i], ys[i]);
+    REQUIRE( batched.toString() == single.toString() );
+    REQUIRE( batched.toString().substr(0, 1) == "M" );
+}
+
+TEST_CASE("transformPoints(...) matches applyX / applyY, including the scale + translate case") {
+    const double xs[] = { 1, 2, 3, 4, 5 }, ys[] = { -1, 0.5, 7, 2, 9 };
+    for (const AffineTransform& m : { AffineTransform(2, 0, 0, 3, 4, 5), AffineTransform(1, 2, 3, 4, 5, 6) }) {
+        double ox[5], oy[5];
+        d3_path::transformPoints(m, xs, ys, 5, ox, oy);
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE( ox[i] == m.applyX(xs[i], ys[i]) );
+            REQUIRE( oy[i] == m.applyY(xs[i], ys[i]) );
+        }
+    }
+}
+
+TEST_CASE("transform.rect(x, y, w, h) stays a rect under scale + translate") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform(2, 0, 0, -1, 10, 0));
+    t.rect(100, 200, 50, 25);
+    REQUIRE_THAT(t, pathEqual("M210,-200h100v-25h-100Z") );
+}
+
+TEST_CASE("transform.rect(x, y, w, h) becomes a polygon under rotation") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::rotate(M_PI / 2));
+    t.rect(0, 0, 10, 20);
+    REQUIRE_THAT(t, pathEqual("M0,0L0,10L-20,10L-20,0Z") );
+}
+
+TEST_CASE("transform.arc(...) stays an arc under a similarity") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::translate(10, 20) * AffineTransform::scale(2, 2));
+    t.arc(0, 0, 50, 0, M_PI / 2);
+    REQUIRE_THAT(t, pathEqual("M110,20A100,100,0,0,1,10,120") );
+}
+
+TEST_CASE("transform.arc(...) flips its direction under a reflection") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::scale(1, -1));
+    t.arc(0, 0, 50, 0, M_PI / 2);
+    REQUIRE_THAT(t, pathEqual("M50,0A50,50,0,0,0,0,-50") );
+}
+
+TEST_CASE("transform.arc(...) draws a full circle under a rotation") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::rotate(M_PI));
+    t.moveTo(150, 100); t.arc(100, 100, 50, 0, 2 * M_PI);
+    REQUIRE_THAT(t, pathEqual("M-150,-100A50,50,0,1,1,-50,-100A50,50,0,1,1,-150,-100") );
+}
+
+TEST_CASE("transform.arc(...) becomes cubic Béziers under a non-uniform scale") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::scale(2, 1));
+    t.arc(0, 0, 1, 0, M_PI / 2);
+    REQUIRE_THAT(t, pathEqual("M2,0C2,0.552285,1.104569,1,0,1") );
+}
+
+TEST_CASE("transform.arcTo(...) matches path.arcTo(...) under the identity") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform());
+    t.moveTo(270, 182), t.arcTo(270, 39, 163, 100, 53);
+    REQUIRE_THAT(t, pathEqual("M270,182L270,130.222686A53,53,0,0,0,190.750991,84.179342") );
+    t.moveTo(100, 100), t.arcTo(200, 100, 200, 200, 100);
+    REQUIRE_THAT(t, pathEqual("M270,182L270,130.222686A53,53,0,0,0,190.750991,84.179342M100,100A100,100,0,0,1,200,200") );
+}
+
+TEST_CASE("transform.arcTo(...) throws an error if the radius is negative") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform());
+    t.moveTo(150, 100);
+    REQUIRE_THROWS_WITH( t.arcTo(270, 39, 163, 100, -53), Catch::Matchers::Contains("negative radius") );
+}
+
+TEST_CASE("transform.quadraticCurveTo(...) on an empty path starts with a moveTo") {
+    auto p = d3_path::path();
+    d3_path::PathTransform t(p, AffineTransform::translate(1, 1));
+    t.quadraticCurveTo(100, 50, 200, 100);
+    REQUIRE_THAT(t, pathEqual("M101,51Q101,51,201,101") );
+}
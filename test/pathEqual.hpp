@@ -32,12 +32,12 @@ inline std::string toFixed(double value, int n) {
 
 static const std::string reNumber = R"([-+]?(?:\d+\.\d+|\d+\.|\.\d+|\d+)(?:[eE][-]?\d+)?)";
 
-std::string formatNumber(const std::smatch& match) {
+inline std::string formatNumber(const std::smatch& match) {
     const double s = std::stod( match.str() );
     return (std::abs(s - std::round(s)) < 1e-6) ? std::to_string( std::round(s) ) : toFixed(s, 6);
 }
 
-std::string normalizePath(const std::string& path) {
+inline std::string normalizePath(const std::string& path) {
     return utils::regex_replace(path, std::regex(reNumber), formatNumber);
 }
 
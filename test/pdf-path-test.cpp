@@ -0,0 +1,158 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/PdfPath.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+
+namespace {
+
+// Content stream of object `id`.
+std::string stream(const std::string& pdf, std::size_t id)
+{
+    const std::size_t obj = pdf.find("\n" + std::to_string(id) + " 0 obj\n");
+    const std::size_t begin = pdf.find("stream\n", obj) + 7;
+    return pdf.substr(begin, pdf.find("\nendstream", begin) - begin);
+}
+
+} // namespace
+
+
+TEST_CASE("pdfPath writes a well-formed single-page document") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    p.beginPage(200, 100);
+    p.moveTo(10, 20);
+    p.lineTo(30.5, 40);
+    p.closePath();
+    p.fill();
+    p.finish();
+
+    REQUIRE(out.compare(0, 9, "%PDF-1.4\n") == 0);
+    REQUIRE(out.compare(out.size() - 6, 6, "%%EOF\n") == 0);
+    REQUIRE(stream(out, 3) == "1 0 0 -1 0 100 cm\n10 20 m\n30.5 40 l\nh\nf\n");
+    REQUIRE(out.find("/MediaBox [0 0 200 100 ]") != std::string::npos);
+    REQUIRE(out.find("/Type /Pages /Kids [5 0 R ] /Count 1") != std::string::npos);
+    REQUIRE(p.pages() == 1);
+}
+
+TEST_CASE("pdfPath.finish() writes an xref table pointing at every object") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    for (int page = 0; page < 3; ++page) {
+        p.beginPage(100, 100);
+        p.rect(page, 0, 10, 10);
+        p.fill();
+    }
+    p.finish();
+
+    const std::size_t startxref = out.rfind("startxref\n");
+    const std::size_t xref = std::strtoul(out.c_str() + startxref + 10, nullptr, 10);
+    REQUIRE(out.compare(xref, 9, "xref\n0 12") == 0);
+
+    const std::size_t entries = out.find('\n', xref + 5) + 1;
+    REQUIRE(out.compare(entries, 20, "0000000000 65535 f \n") == 0);
+    for (std::size_t id = 1; id < 12; ++id) {
+        const std::size_t offset = std::strtoul(out.c_str() + entries + 20 * id, nullptr, 10);
+        const std::string header = std::to_string(id) + " 0 obj\n";
+        REQUIRE(out.compare(offset, header.size(), header) == 0);
+    }
+
+    REQUIRE(out.find("/Kids [5 0 R 8 0 R 11 0 R ] /Count 3") != std::string::npos);
+    REQUIRE(out.find("trailer\n<< /Size 12 /Root 1 0 R >>") != std::string::npos);
+}
+
+TEST_CASE("pdfPath stream lengths match the content streams") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    p.beginPage(100, 100);
+    p.moveTo(0, 0);
+    p.bezierCurveTo(1, 2, 3, 4, 5, 6);
+    p.stroke();
+    p.beginPage(50, 50);
+    p.rect(1, 2, 3, 4);
+    p.fill(d3_path::FillRule::EvenOdd);
+    p.finish();
+
+    for (const std::size_t content : { 3, 6 }) {
+        const std::string data = stream(out, content);
+        const std::size_t lengthObj = out.find("\n" + std::to_string(content + 1) + " 0 obj\n");
+        const std::size_t length = std::strtoul(out.c_str() + out.find("obj\n", lengthObj) + 4, nullptr, 10);
+        REQUIRE(length == data.size());
+    }
+    REQUIRE(stream(out, 3) == "1 0 0 -1 0 100 cm\n0 0 m\n1 2 3 4 5 6 c\nS\n");
+    REQUIRE(stream(out, 6) == "1 0 0 -1 0 50 cm\n1 2 3 4 re\nf*\n");
+}
+
+TEST_CASE("pdfPath writes fixed-point numbers without trailing zeros or negative zero") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink, 3);
+
+    p.beginPage(10, 10);
+    p.moveTo(1.23456, -0.0001);
+    p.lineTo(-2.5, 1e-9);
+    p.setFillColor(1, 0.5, 0.25);
+    p.setLineWidth(0.1);
+    p.finish();
+
+    REQUIRE(stream(out, 3) == "1 0 0 -1 0 10 cm\n1.235 0 m\n-2.5 0 l\n1 0.5 0.25 rg\n0.1 w\n");
+}
+
+TEST_CASE("pdfPath converts arcs and quadratic curves to cubics") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    p.beginPage(100, 100);
+    p.moveTo(0, 0);
+    p.quadraticCurveTo(3, 3, 6, 0);
+    p.arc(50, 50, 10, 0, 3.141592653589793);
+    p.finish();
+
+    const std::string s = stream(out, 3);
+    REQUIRE(s.find("0 0 m\n2 2 4 2 6 0 c\n60 50 l\n") != std::string::npos);
+    REQUIRE(s.find(" 40 50 c\n") != std::string::npos);
+    REQUIRE(s.find(" q") == std::string::npos);
+}
+
+TEST_CASE("pdfPath restarts the path after painting") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    p.beginPage(100, 100);
+    p.moveTo(0, 0);
+    p.lineTo(10, 0);
+    p.stroke();
+    p.lineTo(20, 20);
+    p.finish();
+
+    REQUIRE(stream(out, 3) == "1 0 0 -1 0 100 cm\n0 0 m\n10 0 l\nS\n20 20 m\n");
+}
+
+TEST_CASE("pdfPath throws on drawing outside a page or after finish()") {
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::PdfPath p(sink);
+
+    REQUIRE_THROWS_AS(p.moveTo(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(p.fill(), std::runtime_error);
+    REQUIRE_THROWS_AS(p.endPage(), std::runtime_error);
+
+    p.beginPage(10, 10);
+    p.endPage();
+    p.finish();
+    REQUIRE_THROWS_AS(p.beginPage(10, 10), std::runtime_error);
+    REQUIRE_THROWS_AS(p.lineTo(1, 1), std::runtime_error);
+    REQUIRE_NOTHROW(p.finish());
+}
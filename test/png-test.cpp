@@ -0,0 +1,146 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/Png.hpp"
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include <zlib.h>
+
+#include <cstdlib>
+#include <stdexcept>
+
+
+namespace {
+
+std::uint32_t getU32(const std::string& s, std::size_t pos)
+{
+    return (std::uint32_t(std::uint8_t(s[pos])) << 24) | (std::uint32_t(std::uint8_t(s[pos + 1])) << 16)
+         | (std::uint32_t(std::uint8_t(s[pos + 2])) << 8) | std::uint8_t(s[pos + 3]);
+}
+
+// Minimal RGBA8 PNG decoder: checks the chunk CRCs, inflates and un-filters.
+d3_path::Canvas decodePng(const std::string& png)
+{
+    REQUIRE( png.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0 );
+
+    std::size_t width = 0, height = 0, pos = 8;
+    std::string idat;
+    for (;;) {
+        const std::uint32_t length = getU32(png, pos);
+        const std::string type = png.substr(pos + 4, 4);
+        const uLong crc = crc32(0, reinterpret_cast<const Bytef*>(png.data() + pos + 4), length + 4);
+        REQUIRE( crc == getU32(png, pos + 8 + length) );
+
+        if (type == "IHDR") {
+            width = getU32(png, pos + 8);
+            height = getU32(png, pos + 12);
+            REQUIRE( png.substr(pos + 16, 5) == std::string("\x08\x06\x00\x00\x00", 5) );
+        }
+        if (type == "IDAT") idat += png.substr(pos + 8, length);
+        pos += 12 + length;
+        if (type == "IEND") break;
+    }
+    REQUIRE( pos == png.size() );
+
+    const std::size_t stride = 4 * width;
+    std::string raw(height * (stride + 1), '\0');
+    uLongf rawSize = raw.size();
+    REQUIRE( uncompress(reinterpret_cast<Bytef*>(&raw[0]), &rawSize,
+                        reinterpret_cast<const Bytef*>(idat.data()), idat.size()) == Z_OK );
+    REQUIRE( rawSize == raw.size() );
+
+    d3_path::Canvas canvas(width, height);
+    std::uint8_t* out = canvas.data();
+    for (std::size_t y = 0; y < height; ++y) {
+        const std::uint8_t* line = reinterpret_cast<const std::uint8_t*>(raw.data()) + y * (stride + 1);
+        std::uint8_t* row = out + y * stride;
+        const std::uint8_t* prior = (y > 0) ? row - stride : nullptr;
+        for (std::size_t i = 0; i < stride; ++i) {
+            const int
+                    a = (i >= 4) ? row[i - 4] : 0,
+                    b = prior ? prior[i] : 0,
+                    c = (prior && i >= 4) ? prior[i - 4] : 0;
+            int p = 0;
+            switch (line[0]) {
+            case 0: p = 0; break;
+            case 1: p = a; break;
+            case 2: p = b; break;
+            case 3: p = (a + b) / 2; break;
+            case 4: {
+                const int pa = std::abs(b - c), pb = std::abs(a - c), pc = std::abs(a + b - 2 * c);
+                p = (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+                break;
+            }
+            default: FAIL("bad filter type");
+            }
+            row[i] = static_cast<std::uint8_t>(line[1 + i] + p);
+        }
+    }
+    return canvas;
+}
+
+d3_path::Canvas chart(std::size_t width, std::size_t height)
+{
+    d3_path::Canvas canvas(width, height, d3_path::Color{255, 255, 255, 255});
+    d3_path::Rasterizer r;
+    r.moveTo(0, height);
+    for (std::size_t x = 0; x <= width; x += 3) r.lineTo(x, height / 2.0 + height / 3.0 * (((x * 7) % 23) / 23.0 - 0.5));
+    r.lineTo(width, height);
+    r.fill(canvas, d3_path::Color{70, 130, 180, 200});
+    r.clear();
+    r.arc(width / 3.0, height / 3.0, height / 5.0, 0, 6.3);
+    r.fill(canvas, d3_path::Color{200, 40, 40, 90});
+    return canvas;
+}
+
+bool samePixels(const d3_path::Canvas& a, const d3_path::Canvas& b)
+{
+    if (a.width() != b.width() || a.height() != b.height()) return false;
+    for (std::size_t i = 0; i < a.stride() * a.height(); ++i) {
+        if (a.data()[i] != b.data()[i]) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+
+TEST_CASE("png round-trips a canvas") {
+    const d3_path::Canvas canvas = chart(203, 117);
+    std::string png;
+    d3_path::StringSink sink(png);
+    d3_path::encodePng(canvas, sink);
+    REQUIRE( samePixels(decodePng(png), canvas) );
+    REQUIRE( png.size() < canvas.stride() * canvas.height() / 4 );
+}
+
+TEST_CASE("png chunked parallel deflate decodes to the same pixels at every level") {
+    const d3_path::Canvas canvas = chart(150, 90);
+    for (int level = 0; level <= 9; level += 3) {
+        d3_path::PngOptions options;
+        options.level = level;
+        options.threads = 3;
+        options.chunkRows = 7;
+
+        std::string png;
+        d3_path::StringSink sink(png);
+        d3_path::encodePng(canvas, sink, options);
+        REQUIRE( samePixels(decodePng(png), canvas) );
+    }
+}
+
+TEST_CASE("png encodes widths that are not a multiple of the vector size") {
+    for (std::size_t width = 1; width <= 9; ++width) {
+        const d3_path::Canvas canvas = chart(width, 5);
+        std::string png;
+        d3_path::StringSink sink(png);
+        d3_path::encodePng(canvas, sink);
+        REQUIRE( samePixels(decodePng(png), canvas) );
+    }
+}
+
+TEST_CASE("png refuses an empty canvas") {
+    std::string png;
+    d3_path::StringSink sink(png);
+    REQUIRE_THROWS_AS( d3_path::encodePng(d3_path::Canvas(0, 10), sink), std::runtime_error );
+}
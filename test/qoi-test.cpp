@@ -0,0 +1,114 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/Qoi.hpp"
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include <stdexcept>
+#include <cstring> // for std::memcpy()
+#include <cstdint> // for std::uint8_t
+
+
+namespace {
+
+d3_path::Canvas chart()
+{
+    d3_path::Canvas canvas(97, 61, d3_path::Color{255, 255, 255, 255});
+    d3_path::Rasterizer r;
+    r.moveTo(0, 60);
+    for (int x = 0; x <= 96; x += 4) r.lineTo(x, 30 + 20 * ((x * 7) % 13) / 13.0);
+    r.lineTo(96, 60);
+    r.fill(canvas, d3_path::Color{70, 130, 180, 200});
+    r.clear();
+    r.arc(40, 30, 12, 0, 6.3);
+    r.fill(canvas, d3_path::Color{200, 40, 40, 90});
+    return canvas;
+}
+
+bool samePixels(const d3_path::Canvas& a, const d3_path::Canvas& b)
+{
+    if (a.width() != b.width() || a.height() != b.height()) return false;
+    for (std::size_t i = 0; i < a.stride() * a.height(); ++i) {
+        if (a.data()[i] != b.data()[i]) return false;
+    }
+    return true;
+}
+
+// Remembers the largest write, which must fit the encoder's 64 KiB buffer.
+class LargestWriteSink : public d3_path::StringSink
+{
+public:
+
+    std::size_t largest = 0;
+
+    explicit LargestWriteSink(std::string& out)
+        : d3_path::StringSink( out )
+    { }
+
+    void write(const char* data, std::size_t size) override {
+        if (size > this->largest) this->largest = size;
+        d3_path::StringSink::write(data, size);
+    }
+
+    using d3_path::StringSink::write;
+};
+
+} // namespace
+
+
+TEST_CASE("qoi round-trips a canvas") {
+    const d3_path::Canvas canvas = chart();
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeQoi(canvas, sink);
+
+    REQUIRE( out.compare(0, 4, "qoif") == 0 );
+    REQUIRE( out.size() < canvas.stride() * canvas.height() / 4 );
+    REQUIRE( samePixels(d3_path::decodeQoi(out.data(), out.size()), canvas) );
+}
+
+TEST_CASE("qoi encodes runs longer than 62 pixels and transparent canvases") {
+    const d3_path::Canvas canvas(300, 2);
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeQoi(canvas, sink);
+
+    // Header, an index op (transparent black hashes to the zeroed slot 0), 10 runs of ≤ 62, end marker.
+    REQUIRE( out.size() == 14 + 1 + 10 + 8 );
+    REQUIRE( samePixels(d3_path::decodeQoi(out.data(), out.size()), canvas) );
+}
+
+TEST_CASE("qoi flushes before a run then an RGBA op at the end of its buffer") {
+    // One run pixel, 13106 RGBA pixels (1 + 6 + 13105 * 5 = 65531 bytes), then
+    // a run of one and an RGBA pixel: 6 more bytes, past 65536.
+    const std::size_t rgba = 13106;
+    d3_path::Canvas canvas(rgba + 3, 1);
+    std::uint8_t* p = canvas.data();
+
+    const std::uint8_t first[4] = { 0, 0, 0, 255 };
+    std::memcpy(p, first, 4);
+    for (std::size_t k = 1; k <= rgba; ++k) {
+        const std::uint8_t pixel[4] = { std::uint8_t(k & 255), std::uint8_t(k >> 8), 7, std::uint8_t(k % 2 ? 100 : 200) };
+        std::memcpy(p + 4 * k, pixel, 4);
+    }
+    std::memcpy(p + 4 * (rgba + 1), p + 4 * rgba, 4);
+    const std::uint8_t last[4] = { 1, 2, 3, 100 };
+    std::memcpy(p + 4 * (rgba + 2), last, 4);
+
+    std::string out;
+    LargestWriteSink sink(out);
+    d3_path::encodeQoi(canvas, sink);
+
+    REQUIRE( sink.largest <= 1 << 16 );
+    REQUIRE( samePixels(d3_path::decodeQoi(out.data(), out.size()), canvas) );
+}
+
+TEST_CASE("qoi rejects malformed input") {
+    REQUIRE_THROWS_AS( d3_path::decodeQoi("qoi", 3), std::runtime_error );
+
+    std::string out;
+    d3_path::StringSink sink(out);
+    d3_path::encodeQoi(chart(), sink);
+    out.resize(out.size() / 2);
+    REQUIRE_THROWS_AS( d3_path::decodeQoi(out.data(), out.size()), std::runtime_error );
+}
@@ -0,0 +1,140 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/QtPath.hpp"
+#include "../src/d3_path/PathFlattener.hpp"
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include <QImage>
+#include <QPainter>
+
+#include <cmath>
+
+
+namespace {
+
+// Current point of any PathNormalizer, read back through a flattener replaying the same calls.
+template <typename F>
+QPointF endPoint(F draw)
+{
+    d3_path::PathFlattener f;
+    draw(f);
+    return QPointF(f.points().back().x, f.points().back().y);
+}
+
+bool near(const QPointF& a, const QPointF& b, double tolerance = 1e-6)
+{
+    return std::abs(a.x() - b.x()) < tolerance && std::abs(a.y() - b.y()) < tolerance;
+}
+
+} // namespace
+
+
+TEST_CASE("QtPath builds lines and closed subpaths") {
+    d3_path::QtPath q;
+    q.moveTo(150, 50); q.lineTo(200, 100); q.lineTo(100, 100); q.closePath();
+
+    const QPainterPath& p = q.path();
+    REQUIRE( p.elementCount() == 4 );
+    REQUIRE( p.elementAt(0).isMoveTo() );
+    REQUIRE( p.elementAt(1).isLineTo() );
+    REQUIRE( near(p.elementAt(1), QPointF(200, 100)) );
+    REQUIRE( near(p.elementAt(3), QPointF(150, 50)) );
+    REQUIRE( q.toString().empty() );
+}
+
+TEST_CASE("QtPath starts an empty path at the start of the first segment") {
+    d3_path::QtPath q;
+    q.lineTo(10, 20); q.lineTo(30, 40);
+    REQUIRE( near(q.path().elementAt(0), QPointF(10, 20)) );
+    REQUIRE( q.path().elementAt(0).isMoveTo() );
+}
+
+TEST_CASE("QtPath maps arc onto QPainterPath::arcTo with d3's angles") {
+    const auto draw = [](d3_path::PathInterface& p) { p.moveTo(150, 100); p.arc(100, 100, 50, 0, M_PI / 2); };
+    d3_path::QtPath q;
+    draw(q);
+    REQUIRE( near(q.path().currentPosition(), QPointF(100, 150)) );
+    REQUIRE( near(q.path().currentPosition(), endPoint(draw)) );
+
+    // Clockwise on screen from 3 to 6 o'clock: the bottom-right quadrant.
+    REQUIRE( q.path().pointAtPercent(0.5).x() > 130 );
+    REQUIRE( q.path().pointAtPercent(0.5).y() > 130 );
+}
+
+TEST_CASE("QtPath draws counter-clockwise arcs the other way round") {
+    d3_path::QtPath q;
+    q.moveTo(150, 100); q.arc(100, 100, 50, 0, M_PI / 2, true);
+    REQUIRE( near(q.path().currentPosition(), QPointF(100, 150)) );
+    REQUIRE( q.path().boundingRect().top() < 51 );
+}
+
+TEST_CASE("QtPath draws full circles") {
+    d3_path::QtPath q;
+    q.moveTo(150, 100); q.arc(100, 100, 50, 0, 2 * M_PI);
+    const QRectF bounds = q.path().boundingRect();
+    REQUIRE( std::abs(bounds.left() - 50) < 1e-6 );
+    REQUIRE( std::abs(bounds.width() - 100) < 1e-6 );
+    REQUIRE( near(q.path().currentPosition(), QPointF(150, 100)) );
+}
+
+TEST_CASE("QtPath resolves arcTo as Path does") {
+    const auto draw = [](d3_path::PathInterface& p) { p.moveTo(270, 182); p.arcTo(270, 39, 163, 100, 53); };
+    d3_path::QtPath q;
+    draw(q);
+    REQUIRE( near(q.path().currentPosition(), endPoint(draw)) );
+
+    // Collinear points and zero radii degrade to lines.
+    d3_path::QtPath l;
+    l.moveTo(100, 100); l.arcTo(200, 100, 300, 100, 10); l.arcTo(300, 200, 400, 200, 0);
+    REQUIRE( l.path().elementCount() == 3 );
+    REQUIRE( near(l.path().currentPosition(), QPointF(300, 200)) );
+}
+
+TEST_CASE("QtPath maps rect onto addRect") {
+    d3_path::QtPath q;
+    q.rect(10, 20, 30, 40); q.lineTo(0, 0);
+    REQUIRE( q.path().elementCount() == 6 );
+    REQUIRE( near(q.path().elementAt(2), QPointF(40, 60)) );
+    REQUIRE( q.path().contains(QPointF(25, 40)) );
+}
+
+TEST_CASE("QtPath fills like the built-in rasterizer") {
+    const auto draw = [](d3_path::PathInterface& p) {
+        p.moveTo(20, 180); p.bezierCurveTo(60, 10, 120, 250, 180, 40);
+        p.arcTo(190, 190, 20, 190, 30); p.closePath();
+        p.moveTo(140, 100); p.arc(100, 100, 35, 0, 2 * M_PI, true);
+    };
+
+    d3_path::QtPath q;
+    draw(q);
+    QImage image(200, 200, QImage::Format_ARGB32);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.fillPath(q.path(), Qt::black);
+    painter.end();
+
+    d3_path::Rasterizer r;
+    draw(r);
+    d3_path::Canvas canvas(200, 200);
+    r.fill(canvas, d3_path::Color{0, 0, 0, 255}, d3_path::FillRule::EvenOdd); // QPainterPath defaults to OddEvenFill
+
+    double qt = 0, ours = 0;
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            qt += qAlpha(image.pixel(x, y)) / 255.0;
+            ours += canvas.pixel(x, y).a / 255.0;
+        }
+    }
+    REQUIRE( std::abs(qt / ours - 1) < 0.01 );
+}
+
+TEST_CASE("QtPath.clear() starts over") {
+    d3_path::QtPath q;
+    q.moveTo(0, 0); q.lineTo(10, 10);
+    q.clear();
+    REQUIRE( q.path().isEmpty() );
+    q.lineTo(5, 5);
+    REQUIRE( q.path().elementAt(0).isMoveTo() );
+}
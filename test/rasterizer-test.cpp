@@ -0,0 +1,112 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include <cmath>
+
+
+namespace {
+
+const d3_path::Color black = {0, 0, 0, 255};
+
+// Sum of the alpha channel over the canvas, in pixels.
+double area(const d3_path::Canvas& canvas)
+{
+    double sum = 0;
+    for (std::size_t y = 0; y < canvas.height(); ++y)
+        for (std::size_t x = 0; x < canvas.width(); ++x)
+            sum += canvas.pixel(x, y).a / 255.0;
+    return sum;
+}
+
+} // namespace
+
+
+TEST_CASE("rasterizer fills pixel-aligned rectangles exactly") {
+    d3_path::Rasterizer r;
+    r.rect(2, 3, 4, 5);
+    d3_path::Canvas canvas(10, 10);
+    r.fill(canvas, black);
+    for (std::size_t y = 0; y < 10; ++y) {
+        for (std::size_t x = 0; x < 10; ++x) {
+            const bool inside = (x >= 2 && x < 6 && y >= 3 && y < 8);
+            REQUIRE( canvas.pixel(x, y).a == (inside ? 255 : 0) );
+        }
+    }
+}
+
+TEST_CASE("rasterizer anti-aliases by covered area") {
+    d3_path::Rasterizer r;
+    r.rect(0.5, 0, 1, 1);
+    d3_path::Canvas canvas(3, 1);
+    r.fill(canvas, black);
+    REQUIRE( canvas.pixel(0, 0).a == 128 );
+    REQUIRE( canvas.pixel(1, 0).a == 128 );
+    REQUIRE( canvas.pixel(2, 0).a == 0 );
+
+    // A diagonal halves its pixel.
+    d3_path::Rasterizer t;
+    t.moveTo(0, 0); t.lineTo(1, 1); t.lineTo(0, 1); t.closePath();
+    d3_path::Canvas small(1, 1);
+    t.fill(small, black);
+    REQUIRE( small.pixel(0, 0).a == 128 );
+}
+
+TEST_CASE("rasterizer applies the fill rule") {
+    // Two nested squares, same direction: a hole only with evenodd.
+    d3_path::Rasterizer r;
+    r.rect(0, 0, 8, 8);
+    r.rect(2, 2, 4, 4);
+
+    d3_path::Canvas nonzero(8, 8), evenodd(8, 8);
+    r.fill(nonzero, black, d3_path::FillRule::NonZero);
+    r.fill(evenodd, black, d3_path::FillRule::EvenOdd);
+    REQUIRE( nonzero.pixel(4, 4).a == 255 );
+    REQUIRE( evenodd.pixel(4, 4).a == 0 );
+    REQUIRE( evenodd.pixel(1, 1).a == 255 );
+    REQUIRE( area(nonzero) == 64 );
+    REQUIRE( area(evenodd) == 48 );
+}
+
+TEST_CASE("rasterizer covers the area of a circle") {
+    d3_path::Rasterizer r(0.01);
+    r.arc(100, 100, 60, 0, 2 * M_PI);
+    d3_path::Canvas canvas(200, 200);
+    r.fill(canvas, black);
+    REQUIRE( std::abs(area(canvas) / (M_PI * 60 * 60) - 1) < 1e-3 ); // 8-bit alpha rounding along the edge
+}
+
+TEST_CASE("rasterizer output does not depend on tiling or threads") {
+    d3_path::Rasterizer r;
+    r.moveTo(-20, 10); r.bezierCurveTo(300, -50, 50, 400, 230, 170);
+    r.lineTo(90, 250); r.arc(60, 60, 45, 0, 5, true);
+    r.closePath();
+
+    d3_path::Canvas reference(240, 200);
+    r.setThreads(1);
+    r.setTileSize(1000);
+    r.fill(reference, black, d3_path::FillRule::EvenOdd);
+
+    d3_path::Canvas tiled(240, 200);
+    r.setThreads(4);
+    r.setTileSize(16);
+    r.fill(tiled, black, d3_path::FillRule::EvenOdd);
+
+    std::size_t differences = 0;
+    for (std::size_t y = 0; y < 200; ++y)
+        for (std::size_t x = 0; x < 240; ++x)
+            differences += std::abs(tiled.pixel(x, y).a - reference.pixel(x, y).a) > 1;
+    REQUIRE( differences == 0 );
+    REQUIRE( area(reference) > 1000 );
+}
+
+TEST_CASE("rasterizer composites over the canvas") {
+    d3_path::Rasterizer r;
+    r.rect(0, 0, 1, 1);
+    d3_path::Canvas canvas(2, 1, d3_path::Color{255, 255, 255, 255});
+    r.fill(canvas, d3_path::Color{0, 0, 255, 128});
+    const d3_path::Color c = canvas.pixel(0, 0);
+    REQUIRE( (c.r == 127 && c.g == 127 && c.b == 255 && c.a == 255) );
+    REQUIRE( canvas.pixel(1, 0).r == 255 );
+}
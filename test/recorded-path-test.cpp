@@ -0,0 +1,51 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+
+
+namespace {
+
+void draw(d3_path::PathInterface& p) {
+    p.moveTo(150, 100); p.lineTo(200, 100);
+    p.quadraticCurveTo(100, 50, 200, 100);
+    p.bezierCurveTo(100, 50, 0, 24, 200, 100);
+    p.arcTo(270, 39, 163, 100, 53);
+    p.arc(100, 100, 50, 0, M_PI / 2, true);
+    p.closePath();
+    p.rect(100, 200, 50, 25);
+}
+
+} // namespace
+
+TEST_CASE("recorded.toString() matches the path built directly") {
+    d3_path::RecordedPath r; draw(r);
+    auto p = d3_path::path(); draw(p);
+    REQUIRE( r.toString() == p.toString() );
+    REQUIRE( r.commands().size() == 8 );
+    REQUIRE( r.numbers().size() == 2 + 2 + 4 + 6 + 5 + 6 + 4 );
+}
+
+TEST_CASE("recorded.replay(path) replays every call") {
+    d3_path::RecordedPath r; draw(r);
+    auto p = d3_path::path(); r.replay(p);
+    REQUIRE( p.toString() == r.toString() );
+}
+
+TEST_CASE("recorded.replay(path, dx, dy) translates points but not radii or sizes") {
+    d3_path::RecordedPath r;
+    r.moveTo(0, 0); r.arc(0, 0, 10, 0, M_PI); r.rect(1, 2, 3, 4);
+    auto p = d3_path::path(); r.replay(p, 100, 200);
+    REQUIRE_THAT(p, pathEqual("M100,200L110,200A10,10,0,1,1,90,200M101,202h3v4h-3Z") );
+}
+
+TEST_CASE("recorded.clear() forgets the recorded calls") {
+    d3_path::RecordedPath r; draw(r);
+    r.clear();
+    REQUIRE( r.empty() );
+    REQUIRE( r.numbers().empty() );
+    REQUIRE( r.toString() == "" );
+}
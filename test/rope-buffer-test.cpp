@@ -0,0 +1,129 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/RopePath.hpp"
+
+#include <cstdio> // for std::tmpfile(), std::fread(), fileno()
+
+
+TEST_CASE("rope.append(data, size) fills fixed-size chunks that never move", "[RopeBuffer]") {
+    d3_path::ChunkPool pool(8);
+    d3_path::RopeBuffer rope(&pool);
+
+    rope.append("0123456", 7);
+#ifdef D3_PATH_HAS_POSIX
+    const void* first = rope.iovecs()[0].iov_base;
+#endif
+    rope.append("789abcdefghij", 13);
+
+    REQUIRE( rope.size() == 20 );
+    REQUIRE( rope.capacity() == 24 );
+    REQUIRE( rope.str() == "0123456789abcdefghij" );
+
+#ifdef D3_PATH_HAS_POSIX
+    const std::vector<struct iovec> views = rope.iovecs();
+    REQUIRE( views.size() == 3 );
+    REQUIRE( views[0].iov_base == first );
+    REQUIRE( views[0].iov_len == 8 );
+    REQUIRE( views[2].iov_len == 4 );
+#endif
+}
+
+TEST_CASE("rope.clear() keeps the chunks, shrink_to_fit() gives back the unused ones", "[RopeBuffer]") {
+    d3_path::ChunkPool pool(8);
+    {
+        d3_path::RopeBuffer rope(&pool);
+        rope.append("0123456789abcdefghij", 20);
+        rope.clear();
+        REQUIRE( rope.empty() );
+        REQUIRE( rope.capacity() == 24 );
+
+        rope.append("xy", 2);
+        rope.shrink_to_fit();
+        REQUIRE( rope.capacity() == 8 );
+        REQUIRE( pool.size() == 2 );
+        REQUIRE( rope.str() == "xy" );
+    }
+    REQUIRE( pool.size() == 3 );
+}
+
+TEST_CASE("rope copies are deep, moves steal the chunks", "[RopeBuffer]") {
+    d3_path::ChunkPool pool(4);
+    d3_path::RopeBuffer rope(&pool);
+    rope.append("0123456789", 10);
+
+    d3_path::RopeBuffer copy(rope);
+    rope.append("!", 1);
+    REQUIRE( copy.str() == "0123456789" );
+
+    d3_path::RopeBuffer moved(std::move(rope));
+    REQUIRE( moved.str() == "0123456789!" );
+    REQUIRE( rope.size() == 0 );
+
+    copy = moved;
+    REQUIRE( copy.str() == "0123456789!" );
+}
+
+TEST_CASE("rope.writeTo(fd / sink) writes every chunk", "[RopeBuffer]") {
+    d3_path::ChunkPool pool(16);
+    d3_path::RopeBuffer rope(&pool);
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        const std::string line = "line " + std::to_string(i) + "\n";
+        rope.append(line.data(), line.size());
+        expected += line;
+    }
+
+#ifdef D3_PATH_HAS_POSIX
+    std::FILE* file = std::tmpfile();
+    REQUIRE( file != nullptr );
+    rope.writeTo(fileno(file));
+
+    std::string read(expected.size() + 1, '\0');
+    std::rewind(file);
+    read.resize(std::fread(&read[0], 1, read.size(), file));
+    std::fclose(file);
+    REQUIRE( read == expected );
+#endif
+
+    std::string sunk;
+    d3_path::StringSink sink(sunk);
+    rope.writeTo(sink);
+    REQUIRE( sunk == expected );
+}
+
+TEST_CASE("RopePath serializes like Path", "[RopeBuffer]") {
+    auto expected = d3_path::path();
+    d3_path::RopePath p;
+    for (int i = 0; i < 10000; ++i) {
+        expected.lineTo(i, i * 0.5);
+        p.lineTo(i, i * 0.5);
+    }
+    expected.rect(1, 2, 3, 4);
+    p.rect(1, 2, 3, 4);
+
+    REQUIRE( p.buffer().capacity() > p.buffer().chunkSize() );
+    REQUIRE( p.toString() == expected.toString() );
+
+    p.clear();
+    p.moveTo(1, 2);
+    REQUIRE( p.toString() == "M1,2" );
+}
+
+TEST_CASE("RopePath.append(other) splices chunk by chunk", "[RopeBuffer]") {
+    d3_path::RopePath a, b;
+    auto expected = d3_path::path();
+    for (int i = 0; i < 5000; ++i) {
+        a.lineTo(i, i);
+        b.lineTo(-i, i);
+    }
+    for (int i = 0; i < 5000; ++i) expected.lineTo(i, i);
+    for (int i = 0; i < 5000; ++i) expected.lineTo(-i, i);
+
+    a.append(b);
+    REQUIRE( a.toString() == expected.toString() );
+
+    a.append(a);
+    REQUIRE( a.toString() == expected.toString() + expected.toString() );
+}
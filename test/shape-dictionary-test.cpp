@@ -0,0 +1,78 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/ShapeDictionary.hpp"
+
+
+TEST_CASE("dictionary detects circles drawn at different offsets") {
+    d3_path::ShapeDictionary d;
+    auto p = d3_path::path();
+    for (int i = 0; i < 100; ++i) {
+        for (d3_path::PathInterface* c : { static_cast<d3_path::PathInterface*>(&d), static_cast<d3_path::PathInterface*>(&p) }) {
+            c->moveTo(i * 7.3 + 4.5, i * 0.1); c->arc(i * 7.3, i * 0.1, 4.5, 0, 2 * M_PI);
+        }
+    }
+    REQUIRE( d.shapes() == 1 );
+    REQUIRE( d.instances() == 100 );
+    REQUIRE_THAT(d, pathEqual(p.toString()) );
+}
+
+TEST_CASE("dictionary.toSvg() emits shared shapes as <defs> and <use>") {
+    d3_path::ShapeDictionary d;
+    d.rect(10, 20, 5, 5);
+    d.rect(30, 40, 5, 5);
+    d.moveTo(0, 0); d.lineTo(1, 1);
+    REQUIRE( d.toSvg() ==
+        "<defs><path id=\"shape0\" d=\"M0,0h5v5h-5Z\"/></defs>"
+        "<use href=\"#shape0\" x=\"10\" y=\"20\"/>"
+        "<use href=\"#shape0\" x=\"30\" y=\"40\"/>"
+        "<path d=\"M0,0L1,1\"/>" );
+}
+
+TEST_CASE("dictionary.toSvg(minUses, idPrefix) inlines shapes used fewer than minUses times") {
+    d3_path::ShapeDictionary d;
+    d.rect(10, 20, 5, 5);
+    d.rect(30, 40, 5, 5);
+    REQUIRE( d.toSvg(3, "m") == "<path d=\"M10,20h5v5h-5Z\"/><path d=\"M30,40h5v5h-5Z\"/>" );
+    REQUIRE( d.toSvg(1, "m") == "<defs><path id=\"m0\" d=\"M0,0h5v5h-5Z\"/></defs><use href=\"#m0\" x=\"10\" y=\"20\"/><use href=\"#m0\" x=\"30\" y=\"40\"/>" );
+}
+
+TEST_CASE("dictionary distinguishes shapes that differ beyond the precision") {
+    d3_path::ShapeDictionary d(0.01);
+    d.moveTo(0, 0); d.lineTo(10, 10);
+    d.moveTo(5, 5); d.lineTo(15.001, 15);
+    d.moveTo(5, 5); d.lineTo(15.1, 15);
+    REQUIRE( d.shapes() == 2 );
+    REQUIRE( d.instances() == 3 );
+}
+
+TEST_CASE("dictionary queries leave the subpath in progress open") {
+    d3_path::ShapeDictionary d;
+    auto p = d3_path::path();
+    for (d3_path::PathInterface* c : { static_cast<d3_path::PathInterface*>(&d), static_cast<d3_path::PathInterface*>(&p) }) {
+        c->rect(10, 20, 5, 5);
+        c->moveTo(0, 0); c->lineTo(1, 1);
+    }
+
+    REQUIRE( d.shapes() == 2 );
+    REQUIRE( d.instances() == 2 );
+    REQUIRE_THAT(d, pathEqual(p.toString()) );
+    REQUIRE( d.toSvg(1) ==
+        "<defs><path id=\"shape0\" d=\"M0,0h5v5h-5Z\"/><path id=\"shape1\" d=\"M0,0L1,1\"/></defs>"
+        "<use href=\"#shape0\" x=\"10\" y=\"20\"/>"
+        "<use href=\"#shape1\" x=\"0\" y=\"0\"/>" );
+
+    d.lineTo(2, 0); p.lineTo(2, 0);
+    d.rect(30, 40, 5, 5); p.rect(30, 40, 5, 5);
+    REQUIRE( d.shapes() == 2 );
+    REQUIRE( d.instances() == 3 );
+    REQUIRE_THAT(d, pathEqual(p.toString()) );
+    REQUIRE( d.toSvg() ==
+        "<defs><path id=\"shape0\" d=\"M0,0h5v5h-5Z\"/></defs>"
+        "<use href=\"#shape0\" x=\"10\" y=\"20\"/>"
+        "<path d=\"M0,0L1,1L2,0\"/>"
+        "<use href=\"#shape0\" x=\"30\" y=\"40\"/>" );
+}
@@ -0,0 +1,156 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/SkiaPath.hpp"
+#include "../src/d3_path/Path.hpp"
+#include "../src/d3_path/PathFlattener.hpp"
+#include "../src/d3_path/Rasterizer.hpp"
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPaint.h"
+#include "include/utils/SkParsePath.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+
+
+namespace {
+
+using Draw = std::function<void(d3_path::PathInterface&)>;
+
+// Current point after `draw`, from a flattener replaying the same calls.
+SkPoint endPoint(const Draw& draw)
+{
+    d3_path::PathFlattener f;
+    draw(f);
+    return SkPoint::Make(SkScalar(f.points().back().x), SkScalar(f.points().back().y));
+}
+
+bool near(const SkPoint& a, const SkPoint& b, double tolerance = 1e-3)
+{
+    return std::abs(a.x() - b.x()) < tolerance && std::abs(a.y() - b.y()) < tolerance;
+}
+
+SkPoint lastPoint(const SkPath& path)
+{
+    SkPoint p;
+    REQUIRE( path.getLastPt(&p) );
+    return p;
+}
+
+SkBitmap render(const SkPath& path, int width, int height)
+{
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(width, height);
+    bitmap.eraseColor(SK_ColorTRANSPARENT);
+    SkCanvas canvas(bitmap);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setColor(SK_ColorBLACK);
+    canvas.drawPath(path, paint);
+    return bitmap;
+}
+
+const Draw chart = [](d3_path::PathInterface& p) {
+    p.moveTo(20, 180); p.bezierCurveTo(60, 10, 120, 250, 180, 40);
+    p.arcTo(190, 190, 20, 190, 30); p.closePath();
+    p.moveTo(140, 100); p.arc(100, 100, 35, 0, 2 * M_PI, true);
+    p.rect(150, 150, 30, -20);
+    p.moveTo(10, 10); p.quadraticCurveTo(60, 0, 40, 50); p.arc(30, 40, 12, 1, 4);
+};
+
+} // namespace
+
+
+TEST_CASE("SkiaPath builds lines and closed subpaths") {
+    d3_path::SkiaPath s;
+    s.moveTo(150, 50); s.lineTo(200, 100); s.lineTo(100, 100); s.closePath();
+    REQUIRE( s.path().countPoints() == 3 );
+    REQUIRE( s.path().countVerbs() == 4 );
+    REQUIRE( near(s.path().getPoint(1), SkPoint::Make(200, 100)) );
+    REQUIRE( s.toString().empty() );
+}
+
+TEST_CASE("SkiaPath maps arc onto SkPath::arcTo with d3's angles") {
+    for (const bool ccw : { false, true }) {
+        const Draw draw = [ccw](d3_path::PathInterface& p) { p.moveTo(150, 100); p.arc(100, 100, 50, 0, M_PI / 2, ccw); };
+        d3_path::SkiaPath s;
+        draw(s);
+        REQUIRE( near(lastPoint(s.path()), SkPoint::Make(100, 150)) );
+        REQUIRE( near(lastPoint(s.path()), endPoint(draw)) );
+        // Clockwise stays in the bottom-right quadrant; counter-clockwise goes round the top.
+        REQUIRE( (s.path().getBounds().top() < 51) == ccw );
+    }
+}
+
+TEST_CASE("SkiaPath draws full circles") {
+    d3_path::SkiaPath s;
+    s.moveTo(150, 100); s.arc(100, 100, 50, 0, 2 * M_PI);
+    const SkRect bounds = s.path().computeTightBounds();
+    REQUIRE( std::abs(bounds.left() - 50) < 1e-3 );
+    REQUIRE( std::abs(bounds.width() - 100) < 1e-3 );
+    REQUIRE( near(lastPoint(s.path()), SkPoint::Make(150, 100)) );
+}
+
+TEST_CASE("SkiaPath resolves arcTo with the epsilon rules of Path") {
+    const Draw draw = [](d3_path::PathInterface& p) { p.moveTo(270, 182); p.arcTo(270, 39, 163, 100, 53); };
+    d3_path::SkiaPath s;
+    draw(s);
+    REQUIRE( near(lastPoint(s.path()), endPoint(draw)) );
+
+    // Coincident points do nothing, collinear points and zero radii degrade to lines.
+    d3_path::SkiaPath l;
+    l.moveTo(100, 100); l.arcTo(100, 100, 200, 200, 10); l.arcTo(200, 100, 300, 100, 10); l.arcTo(300, 200, 400, 200, 0);
+    REQUIRE( l.path().countVerbs() == 3 );
+    REQUIRE( near(lastPoint(l.path()), SkPoint::Make(300, 200)) );
+}
+
+TEST_CASE("SkiaPath rasterizes like the SVG string route") {
+    d3_path::SkiaPath direct;
+    chart(direct);
+
+    d3_path::Path p;
+    chart(p);
+    SkPath parsed;
+    REQUIRE( SkParsePath::FromSVGString(p.toString().c_str(), &parsed) );
+
+    const SkBitmap a = render(direct.path(), 200, 200), b = render(parsed, 200, 200);
+    int differences = 0;
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            differences += std::abs(int(SkColorGetA(a.getColor(x, y))) - int(SkColorGetA(b.getColor(x, y)))) > 8;
+        }
+    }
+    REQUIRE( differences == 0 );
+}
+
+TEST_CASE("SkiaPath rasterizes like the built-in rasterizer") {
+    d3_path::SkiaPath s;
+    chart(s);
+    const SkBitmap bitmap = render(s.path(), 200, 200); // kWinding fill, as FillRule::NonZero
+
+    d3_path::Rasterizer r;
+    chart(r);
+    d3_path::Canvas canvas(200, 200);
+    r.fill(canvas, d3_path::Color{0, 0, 0, 255});
+
+    double skia = 0, ours = 0;
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            skia += SkColorGetA(bitmap.getColor(x, y)) / 255.0;
+            ours += canvas.pixel(x, y).a / 255.0;
+        }
+    }
+    REQUIRE( std::abs(skia / ours - 1) < 0.01 );
+}
+
+TEST_CASE("SkiaPath.clear() starts over") {
+    d3_path::SkiaPath s;
+    s.moveTo(0, 0); s.lineTo(10, 10);
+    s.clear();
+    REQUIRE( s.path().isEmpty() );
+    s.lineTo(5, 5);
+    REQUIRE( s.path().countPoints() == 1 );
+}
@@ -0,0 +1,149 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/Stroker.hpp"
+#include "../src/d3_path/Tessellator.hpp"
+
+#include <cmath>
+
+
+namespace {
+
+// Area of the stroke of the path drawn by `draw`, filled with nonzero.
+template <typename F>
+double strokeArea(const d3_path::StrokeStyle& style, F draw)
+{
+    d3_path::Tessellator outline(1e-3);
+    d3_path::Stroker stroker(outline, style, 1e-3);
+    draw(stroker);
+    stroker.finish();
+
+    d3_path::Mesh mesh;
+    outline.fill(mesh);
+
+    double sum = 0;
+    const float* v = mesh.vertices.data();
+    for (std::size_t t = 0; t < mesh.triangleCount(); ++t) {
+        const std::uint32_t a = mesh.indices[3 * t], b = mesh.indices[3 * t + 1], c = mesh.indices[3 * t + 2];
+        sum += ((v[2 * b] - v[2 * a]) * (v[2 * c + 1] - v[2 * a + 1]) - (v[2 * c] - v[2 * a]) * (v[2 * b + 1] - v[2 * a + 1])) / 2.0;
+    }
+    return sum;
+}
+
+void line(d3_path::PathInterface& p)
+{
+    p.moveTo(0, 0); p.lineTo(10, 0);
+}
+
+void corner(d3_path::PathInterface& p)
+{
+    p.moveTo(0, 0); p.lineTo(10, 0); p.lineTo(10, 10);
+}
+
+} // namespace
+
+
+TEST_CASE("stroker outlines a line as one closed contour") {
+    auto p = d3_path::path();
+    d3_path::Stroker s(p, d3_path::StrokeStyle(2));
+    line(s);
+    s.finish();
+    REQUIRE_THAT(p, pathEqual("M0,1L10,1L10,-1L0,-1L0,1Z"));
+}
+
+TEST_CASE("stroker applies the line cap") {
+    using d3_path::StrokeStyle;
+    using d3_path::LineJoin;
+    using d3_path::LineCap;
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter, LineCap::Butt), line) == Approx(20) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter, LineCap::Square), line) == Approx(24) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter, LineCap::Round), line) == Approx(20 + M_PI).epsilon(5e-4) );
+}
+
+TEST_CASE("stroker applies the line join") {
+    using d3_path::StrokeStyle;
+    using d3_path::LineJoin;
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter), corner) == Approx(40) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Bevel), corner) == Approx(39.5) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Round), corner) == Approx(39 + M_PI / 4).epsilon(1e-4) );
+}
+
+TEST_CASE("stroker falls back to bevel joins beyond the miter limit") {
+    using d3_path::StrokeStyle;
+    using d3_path::LineJoin;
+    using d3_path::LineCap;
+    // A right angle has a miter ratio of √2.
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter, LineCap::Butt, 1.5), corner) == Approx(40) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter, LineCap::Butt, 1.4), corner) == Approx(39.5) );
+}
+
+TEST_CASE("stroker outlines closed subpaths as two contours") {
+    using d3_path::StrokeStyle;
+    using d3_path::LineJoin;
+    const auto square = [](d3_path::PathInterface& p) { p.rect(0, 0, 10, 10); };
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Miter), square) == Approx(144 - 64) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Bevel), square) == Approx(144 - 64 - 4 * 0.5) );
+    REQUIRE( strokeArea(StrokeStyle(2, LineJoin::Round), square) == Approx(144 - 64 - 4 * (1 - M_PI / 4)).epsilon(1e-4) );
+
+    auto p = d3_path::path();
+    d3_path::Stroker s(p, StrokeStyle(2));
+    square(s);
+    s.finish();
+    REQUIRE_THAT(p, pathEqual("M0,1L10,1L10,0L9,0L9,10L10,10L10,9L0,9L0,10L1,10L1,0L0,0L0,1Z"
+                              "M-1,0L-1,10L-1,11L0,11L10,11L11,11L11,10L11,0L11,-1L10,-1L0,-1L-1,-1L-1,0Z"));
+}
+
+TEST_CASE("stroker offsets arcs with concentric arcs") {
+    auto p = d3_path::path();
+    d3_path::Stroker s(p, d3_path::StrokeStyle(2));
+    s.moveTo(10, 0);
+    s.arc(0, 0, 10, 0, M_PI / 2);
+    s.finish();
+    REQUIRE_THAT(p, pathEqual("M9,0A9,9,0,0,1,0,9L0,11A11,11,0,0,0,11,0L9,0Z"));
+
+    const auto circle = [](d3_path::PathInterface& p) { p.moveTo(10, 0); p.arc(0, 0, 10, 0, 2 * M_PI); p.closePath(); };
+    REQUIRE( strokeArea(d3_path::StrokeStyle(2), circle) == Approx(M_PI * (121 - 81)).epsilon(1e-4) );
+}
+
+TEST_CASE("stroker offsets arcs thinner than the stroke through their center") {
+    // Half a disc of radius 3 on the arc side, half a disc of radius 1 beyond the center.
+    const auto arc = [](d3_path::PathInterface& p) { p.moveTo(1, 0); p.arc(0, 0, 1, 0, M_PI); };
+    REQUIRE( strokeArea(d3_path::StrokeStyle(4), arc) == Approx(M_PI * 9 / 2 + M_PI / 2).epsilon(1e-3) );
+}
+
+TEST_CASE("stroker approximates the offset of curves within the tolerance") {
+    // A straight cubic, then a bend: the stroke is length × width, away from the caps.
+    const auto straight = [](d3_path::PathInterface& p) { p.moveTo(0, 0); p.bezierCurveTo(30, 0, 70, 0, 100, 0); };
+    REQUIRE( strokeArea(d3_path::StrokeStyle(2), straight) == Approx(200) );
+
+    const auto bend = [](d3_path::PathInterface& p) { p.moveTo(0, 0); p.bezierCurveTo(50, 0, 100, 50, 100, 100); };
+    double length = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const double t = (i + 0.5) / 100000, mt = 1 - t;
+        const double dx = 3 * (mt * mt * 50 + 2 * mt * t * 50 + t * t * 0), dy = 3 * (mt * mt * 0 + 2 * mt * t * 50 + t * t * 50);
+        length += std::sqrt(dx * dx + dy * dy) / 100000;
+    }
+    REQUIRE( strokeArea(d3_path::StrokeStyle(2), bend) == Approx(2 * length).epsilon(1e-3) );
+}
+
+TEST_CASE("stroker converts quadratic curves and strokes each subpath") {
+    auto p = d3_path::path();
+    d3_path::Stroker s(p, d3_path::StrokeStyle(2));
+    s.moveTo(0, 0); s.lineTo(10, 0);
+    s.moveTo(0, 5); s.quadraticCurveTo(5, 5, 10, 5);
+    s.moveTo(20, 20);
+    s.finish();
+    REQUIRE_THAT(p, pathEqual("M0,1L10,1L10,-1L0,-1L0,1Z"
+                              "M0,6C3.333333,6,6.666667,6,10,6L10,4C6.666667,4,3.333333,4,0,4L0,6Z"));
+}
+
+TEST_CASE("stroker skips zero-length segments") {
+    auto p = d3_path::path();
+    d3_path::Stroker s(p, d3_path::StrokeStyle(2));
+    s.moveTo(0, 0); s.lineTo(0, 0); s.lineTo(10, 0); s.lineTo(10, 0);
+    s.finish();
+    REQUIRE_THAT(p, pathEqual("M0,1L10,1L10,-1L0,-1L0,1Z"));
+}
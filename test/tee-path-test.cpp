@@ -0,0 +1,130 @@
+#include "catch/catch.hpp"
+
+
+#include "pathEqual.hpp"
+
+#include "../src/d3_path/path.hpp"
+#include "../src/d3_path/TeePath.hpp"
+#include "../src/d3_path/RecordedPath.hpp"
+#include "../src/d3_path/PathTransform.hpp"
+
+#include <cmath>
+
+
+namespace {
+
+template <typename P>
+void generate(P& p)
+{
+    p.moveTo(150, 50);
+    p.lineTo(200, 100);
+    p.quadraticCurveTo(100, 50, 200, 100);
+    p.bezierCurveTo(100, 50, 0, 24, 200, 100);
+    p.arcTo(270, 39, 163, 100, 53);
+    p.arc(100, 100, 50, 0, M_PI / 2, true);
+    p.closePath();
+    p.rect(200, 100, 70, 10);
+}
+
+// A PathTransform that also counts its rect calls.
+class CountingTransform : public d3_path::PathTransform
+{
+public:
+    int rects = 0;
+
+    using d3_path::PathTransform::PathTransform;
+
+    void rect(number_t x, number_t y, number_t w, number_t h) override {
+        ++this->rects;
+        d3_path::PathTransform::rect(x, y, w, h);
+    }
+};
+
+} // namespace
+
+TEST_CASE("TeePath forwards every call to each target", "[TeePath]") {
+    auto expected = d3_path::path();
+    generate(expected);
+
+    auto a = d3_path::path();
+    auto b = d3_path::path();
+    d3_path::RecordedPath recorded;
+    d3_path::TeePath tee({ &a, &b });
+    tee.add(recorded);
+    generate(tee);
+
+    auto replayed = d3_path::path();
+    recorded.replay(replayed);
+
+    REQUIRE( tee.targets().size() == 3 );
+    REQUIRE_THAT(a, pathEqual(expected.toString()));
+    REQUIRE_THAT(b, pathEqual(expected.toString()));
+    REQUIRE_THAT(replayed, pathEqual(expected.toString()));
+}
+
+TEST_CASE("TeePath.toString() returns the first target's string", "[TeePath]") {
+    d3_path::TeePath empty;
+    empty.moveTo(1, 2);
+    REQUIRE( empty.toString() == "" );
+
+    d3_path::RecordedPath recorded;
+    auto p = d3_path::path();
+    d3_path::TeePath tee({ &p, &recorded });
+    tee.moveTo(1, 2);
+    REQUIRE( tee.toString() == "M1,2" );
+}
+
+TEST_CASE("tee(…) forwards to targets of known types", "[TeePath]") {
+    auto expected = d3_path::path();
+    generate(expected);
+
+    auto svg = d3_path::path();
+    d3_path::RecordedPath recorded;
+    auto scaled = d3_path::path();
+    d3_path::PathTransform transform(scaled, d3_path::AffineTransform::scale(2, 2));
+
+    auto all = d3_path::tee(svg, recorded, transform);
+    generate(all);
+    REQUIRE( all.toString() == expected.toString() );
+
+    auto replayed = d3_path::path();
+    recorded.replay(replayed);
+    REQUIRE_THAT(svg, pathEqual(expected.toString()));
+    REQUIRE_THAT(replayed, pathEqual(expected.toString()));
+
+    auto direct = d3_path::path();
+    d3_path::PathTransform directTransform(direct, d3_path::AffineTransform::scale(2, 2));
+    generate(directTransform);
+    REQUIRE_THAT(scaled, pathEqual(direct.toString()));
+}
+
+TEST_CASE("tee(…) honours overrides behind base-typed targets", "[TeePath]") {
+    auto expected = d3_path::path();
+    generate(expected);
+
+    auto svg = d3_path::path();
+    auto scaled = d3_path::path();
+    CountingTransform counting(scaled, d3_path::AffineTransform::scale(2, 2));
+    d3_path::PathTransform& transform = counting;
+    d3_path::PathInterface& target = svg;
+
+    auto both = d3_path::tee(target, transform);
+    generate(both);
+
+    REQUIRE( counting.rects == 1 );
+    REQUIRE_THAT(svg, pathEqual(expected.toString()));
+}
+
+TEST_CASE("tee(…) is itself a PathInterface", "[TeePath]") {
+    auto a = d3_path::path();
+    auto b = d3_path::path();
+    auto inner = d3_path::tee(b);
+    auto outer = d3_path::tee(a, inner);
+
+    d3_path::PathInterface& p = outer;
+    p.moveTo(0, 0);
+    p.lineTo(10, 10);
+
+    REQUIRE_THAT(a, pathEqual("M0,0L10,10"));
+    REQUIRE_THAT(b, pathEqual("M0,0L10,10"));
+}
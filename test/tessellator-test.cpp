@@ -0,0 +1,149 @@
+#include "catch/catch.hpp"
+
+
+#include "../src/d3_path/Tessellator.hpp"
+
+#include <cmath>
+
+
+namespace {
+
+// Signed area of triangle t, positive when clockwise on screen.
+double triangleArea(const d3_path::Mesh& mesh, std::size_t t)
+{
+    const float* v = mesh.vertices.data();
+    const std::uint32_t a = mesh.indices[3 * t], b = mesh.indices[3 * t + 1], c = mesh.indices[3 * t + 2];
+    return ((v[2 * b] - v[2 * a]) * (v[2 * c + 1] - v[2 * a + 1]) - (v[2 * c] - v[2 * a]) * (v[2 * b + 1] - v[2 * a + 1])) / 2.0;
+}
+
+// Total area, requiring every triangle to be clockwise (or degenerate).
+double area(const d3_path::Mesh& mesh)
+{
+    double sum = 0;
+    for (std::size_t t = 0; t < mesh.triangleCount(); ++t) {
+        const double a = triangleArea(mesh, t);
+        REQUIRE( a >= -1e-9 );
+        sum += a;
+    }
+    return sum;
+}
+
+void star(d3_path::PathInterface& p)
+{
+    // Pentagram: its center has winding number 2.
+    for (int i = 0; i < 5; ++i) {
+        const double a = -M_PI / 2 + i * 4 * M_PI / 5;
+        if (i == 0) p.moveTo(50 + 40 * std::cos(a), 50 + 40 * std::sin(a));
+        else        p.lineTo(50 + 40 * std::cos(a), 50 + 40 * std::sin(a));
+    }
+    p.closePath();
+}
+
+} // namespace
+
+
+TEST_CASE("tessellator splits a rectangle into two triangles sharing four vertices") {
+    d3_path::Tessellator t;
+    t.rect(2, 3, 4, 5);
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    REQUIRE( mesh.vertexCount() == 4 );
+    REQUIRE( mesh.triangleCount() == 2 );
+    REQUIRE( area(mesh) == Approx(20) );
+}
+
+TEST_CASE("tessellator covers a convex polygon with one trapezoid per vertex pair") {
+    d3_path::Tessellator t;
+    t.moveTo(0, 0); t.lineTo(10, 0); t.lineTo(5, 10); t.closePath();
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    REQUIRE( mesh.vertexCount() == 3 );
+    REQUIRE( mesh.triangleCount() == 1 );
+    REQUIRE( area(mesh) == Approx(50) );
+}
+
+TEST_CASE("tessellator applies the fill rule") {
+    // Two nested squares, same direction: a hole only with evenodd.
+    d3_path::Tessellator t;
+    t.rect(0, 0, 8, 8);
+    t.rect(2, 2, 4, 4);
+
+    d3_path::Mesh nonZero, evenOdd;
+    t.fill(nonZero, d3_path::FillRule::NonZero);
+    t.fill(evenOdd, d3_path::FillRule::EvenOdd);
+    REQUIRE( area(nonZero) == Approx(64) );
+    REQUIRE( area(evenOdd) == Approx(48) );
+}
+
+TEST_CASE("tessellator handles self-intersecting contours") {
+    d3_path::Tessellator t;
+    star(t);
+
+    const double r = 40, inner = r * std::sin(M_PI / 10) / std::sin(7 * M_PI / 10);
+    const double pentagon = 2.5 * inner * inner * std::sin(2 * M_PI / 5);
+    const double points = 2.5 * r * inner * std::sin(M_PI / 5) * 2 - pentagon;
+
+    d3_path::Mesh nonZero, evenOdd;
+    t.fill(nonZero, d3_path::FillRule::NonZero);
+    t.fill(evenOdd, d3_path::FillRule::EvenOdd);
+    REQUIRE( area(nonZero) == Approx(points + pentagon) );
+    REQUIRE( area(evenOdd) == Approx(points) );
+}
+
+TEST_CASE("tessellator merges overlapping contours with nonzero") {
+    d3_path::Tessellator t;
+    t.rect(0, 0, 10, 10);
+    t.rect(5, 5, 10, 10);
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    REQUIRE( area(mesh) == Approx(175) );
+}
+
+TEST_CASE("tessellator flattens arcs within the tolerance") {
+    d3_path::Tessellator t(0.01);
+    t.moveTo(60, 50);
+    t.arc(50, 50, 10, 0, 2 * M_PI);
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    REQUIRE( area(mesh) == Approx(M_PI * 100).epsilon(2e-3) ); // chords lose ≈ ⅔ · perimeter · tolerance
+}
+
+TEST_CASE("tessellator appends to the mesh") {
+    d3_path::Tessellator t;
+    t.rect(0, 0, 1, 1);
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    t.clear();
+    t.rect(5, 5, 1, 1);
+    t.fill(mesh);
+    REQUIRE( mesh.vertexCount() == 8 );
+    REQUIRE( mesh.triangleCount() == 4 );
+    for (std::size_t i = 6; i < 12; ++i) REQUIRE( mesh.indices[i] >= 4 );
+    REQUIRE( area(mesh) == Approx(2) );
+
+    mesh.clear();
+    REQUIRE( mesh.vertexCount() == 0 );
+    REQUIRE( mesh.triangleCount() == 0 );
+}
+
+TEST_CASE("tessellator output is deterministic") {
+    d3_path::Tessellator t;
+    star(t);
+    t.moveTo(20, 20); t.bezierCurveTo(80, 0, 0, 100, 90, 90); t.closePath();
+
+    d3_path::Mesh a, b;
+    t.fill(a);
+    t.fill(b);
+    REQUIRE( a.vertices == b.vertices );
+    REQUIRE( a.indices == b.indices );
+}
+
+TEST_CASE("tessellator ignores empty and degenerate paths") {
+    d3_path::Tessellator t;
+    d3_path::Mesh mesh;
+    t.fill(mesh);
+    t.moveTo(0, 0); t.lineTo(10, 0); t.closePath();
+    t.fill(mesh);
+    REQUIRE( mesh.vertexCount() == 0 );
+    REQUIRE( mesh.triangleCount() == 0 );
+}